@@ -0,0 +1,296 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.cpp
+
+  ==============================================================================
+*/
+
+#include "BatchRenderer.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    struct Settings
+    {
+        juce::File inputDirectory, outputDirectory;
+        juce::MemoryBlock state;
+        int program;
+        int chunkSize;
+        double maximumSampleRate;
+    };
+
+    struct FileResult
+    {
+        juce::File file;
+        double audioSeconds = 0.0, renderSeconds = 0.0;
+        juce::String error;
+    };
+
+    //==============================================================================
+    /**
+        Takes files from a shared list until there are none left, rendering each
+        one with its own processor.
+    */
+    class RenderWorker  : public juce::ThreadPoolJob
+    {
+    public:
+        /** The processor is created here, on the message thread, and only ever
+            used by this job afterwards.
+        */
+        RenderWorker (const Settings& renderSettings, const juce::Array<juce::File>& filesToRender,
+                      std::atomic<int>& nextFileIndex, std::vector<FileResult>& fileResults)
+            : juce::ThreadPoolJob ("Render worker"),
+              settings (renderSettings), files (filesToRender), nextFile (nextFileIndex), results (fileResults)
+        {
+            formatManager.registerFormat (new juce::WavAudioFormat(), true);
+            formatManager.registerFormat (new juce::AiffAudioFormat(), false);
+
+            if (settings.state.getSize() > 0)
+                processor.setStateInformation (settings.state.getData(), (int) settings.state.getSize());
+
+            if (settings.program >= 0)
+                processor.setCurrentProgram (settings.program);
+
+            processor.setNonRealtime (true);
+
+            // Sized once for every file it may be given, and freed as soon as
+            // the worker has run out of them
+            processor.setMaximumProcessingSpec (settings.maximumSampleRate, settings.chunkSize);
+            processor.setFreeMemoryOnRelease (true);
+        }
+
+        JobStatus runJob() override
+        {
+            for (auto index = nextFile++; index < files.size() && ! shouldExit(); index = nextFile++)
+                results[(size_t) index] = renderFile (files.getReference (index));
+
+            processor.releaseResources();
+            return jobHasFinished;
+        }
+
+    private:
+        FileResult renderFile (const juce::File& inputFile)
+        {
+            FileResult result;
+            result.file = inputFile;
+
+            std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (inputFile));
+
+            if (reader == nullptr)
+            {
+                result.error = "could not be read";
+                return result;
+            }
+
+            const auto numChannels = (int) reader->numChannels;
+
+            if (numChannels > ChorusEngineBase::maxChannels)
+            {
+                result.error = "has more than " + juce::String (ChorusEngineBase::maxChannels) + " channels";
+                return result;
+            }
+
+            const auto outputFile = settings.outputDirectory.getChildFile (inputFile.getRelativePathFrom (settings.inputDirectory));
+            outputFile.getParentDirectory().createDirectory();
+            outputFile.deleteFile();
+
+            auto* format = formatManager.findFormatForFileExtension (inputFile.getFileExtension());
+            auto stream = outputFile.createOutputStream();
+            std::unique_ptr<juce::AudioFormatWriter> writer;
+
+            if (format != nullptr && stream != nullptr)
+                writer.reset (format->createWriterFor (stream.get(), reader->sampleRate, (unsigned int) numChannels,
+                                                      (int) reader->bitsPerSample, reader->metadataValues, 0));
+
+            if (writer == nullptr)
+            {
+                stream.reset();
+                outputFile.deleteFile();
+                result.error = "could not be written to " + outputFile.getFullPathName();
+                return result;
+            }
+
+            stream.release(); // the writer owns the stream now
+
+            const auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+            prepare (reader->sampleRate, numChannels);
+
+            // The output is delayed by any oversampling latency, so that many
+            // samples are dropped from the start and rendered past the end.
+            const auto latency = (juce::int64) processor.getLatencySamples();
+            const auto length = reader->lengthInSamples;
+
+            for (juce::int64 position = 0; position < length + latency; position += settings.chunkSize)
+            {
+                const auto numSamples = (int) juce::jmin ((juce::int64) settings.chunkSize, length + latency - position);
+
+                // Reads past the end of the file come back as silence. The last
+                // chunk is usually short, so only that many samples are processed.
+                reader->read (&buffer, 0, numSamples, position, true, true);
+                juce::AudioBuffer<float> block (buffer.getArrayOfWritePointers(), numChannels, numSamples);
+                processor.processBlock (block, midi);
+
+                const auto numToSkip = (int) juce::jlimit ((juce::int64) 0, (juce::int64) numSamples, latency - position);
+
+                if (! writer->writeFromAudioSampleBuffer (block, numToSkip, numSamples - numToSkip))
+                {
+                    // Don't leave a partial render where it could be mistaken for a finished one
+                    writer.reset();
+                    outputFile.deleteFile();
+                    result.error = "failed while writing " + outputFile.getFullPathName();
+                    return result;
+                }
+            }
+
+            writer.reset();
+
+            result.audioSeconds = (double) length / reader->sampleRate;
+            result.renderSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+            return result;
+        }
+
+        /** Prepares the processor for a file, only when the sample rate or
+            channel count differs from the last file. It's sized for the highest
+            rate among the files, so only a change of channel count reallocates.
+        */
+        void prepare (double sampleRate, int numChannels)
+        {
+            if (sampleRate != preparedSampleRate || numChannels != preparedNumChannels)
+            {
+                processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, settings.chunkSize);
+                processor.prepareToPlay (sampleRate, settings.chunkSize);
+
+                preparedSampleRate = sampleRate;
+                preparedNumChannels = numChannels;
+            }
+
+            processor.reset();
+            buffer.setSize (numChannels, settings.chunkSize, false, false, true);
+        }
+
+        const Settings& settings;
+        const juce::Array<juce::File>& files;
+        std::atomic<int>& nextFile;
+        std::vector<FileResult>& results;
+
+        BasicChorusAudioProcessor processor;
+        juce::AudioFormatManager formatManager;
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+        double preparedSampleRate = 0.0;
+        int preparedNumChannels = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (RenderWorker)
+    };
+
+    double findHighestSampleRate (const juce::Array<juce::File>& files)
+    {
+        juce::AudioFormatManager formatManager;
+        formatManager.registerFormat (new juce::WavAudioFormat(), true);
+        formatManager.registerFormat (new juce::AiffAudioFormat(), false);
+
+        auto highestSampleRate = 0.0;
+
+        // Only the headers are read; files that can't be are reported later
+        for (auto& file : files)
+            if (std::unique_ptr<juce::AudioFormatReader> reader { formatManager.createReaderFor (file) })
+                highestSampleRate = juce::jmax (highestSampleRate, reader->sampleRate);
+
+        return highestSampleRate;
+    }
+
+    juce::String formatThroughput (double audioSeconds, double renderSeconds)
+    {
+        const auto realtimeFactor = renderSeconds > 0.0 ? audioSeconds / renderSeconds : 0.0;
+
+        return juce::String (audioSeconds, 1) + " s of audio in " + juce::String (renderSeconds, 2)
+                 + " s (" + juce::String (realtimeFactor, 1) + "x realtime)";
+    }
+}
+
+//==============================================================================
+void runBatchRender (const juce::ArgumentList& args)
+{
+    Settings settings;
+    settings.inputDirectory  = args.getExistingFolderForOption ("--input");
+    settings.outputDirectory = args.getFileForOption ("--output");
+    settings.program         = args.containsOption ("--program") ? args.getValueForOption ("--program").getIntValue() : -1;
+    settings.chunkSize       = args.containsOption ("--chunk-size") ? args.getValueForOption ("--chunk-size").getIntValue() : 65536;
+
+    if (settings.chunkSize <= 0)
+        juce::ConsoleApplication::fail ("The chunk size must be positive");
+
+    if (args.containsOption ("--state"))
+    {
+        const auto stateFile = args.getExistingFileForOption ("--state");
+
+        if (! stateFile.loadFileAsData (settings.state))
+            juce::ConsoleApplication::fail ("Could not read " + stateFile.getFullPathName());
+    }
+
+    if (settings.outputDirectory == settings.inputDirectory || settings.outputDirectory.createDirectory().failed())
+        juce::ConsoleApplication::fail ("The output must be a different directory that can be created");
+
+    auto files = settings.inputDirectory.findChildFiles (juce::File::findFiles, args.containsOption ("--recursive"),
+                                                         "*.wav;*.aif;*.aiff");
+    files.sort();
+
+    if (files.isEmpty())
+        juce::ConsoleApplication::fail ("There are no WAV or AIFF files in " + settings.inputDirectory.getFullPathName());
+
+    settings.maximumSampleRate = findHighestSampleRate (files);
+
+    const auto numThreads = args.containsOption ("--threads") ? args.getValueForOption ("--threads").getIntValue()
+                                                              : juce::SystemStats::getNumCpus();
+    const auto numWorkers = juce::jlimit (1, files.size(), numThreads);
+
+    std::atomic<int> nextFile { 0 };
+    std::vector<FileResult> results ((size_t) files.size());
+    std::vector<std::unique_ptr<RenderWorker>> workers;
+
+    for (int i = 0; i < numWorkers; ++i)
+        workers.push_back (std::make_unique<RenderWorker> (settings, files, nextFile, results));
+
+    const auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+    {
+        juce::ThreadPool pool (numWorkers);
+
+        for (auto& worker : workers)
+            pool.addJob (worker.get(), false);
+
+        for (auto& worker : workers)
+            pool.waitForJobToFinish (worker.get(), -1);
+    }
+
+    const auto wallSeconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+
+    auto totalAudioSeconds = 0.0, totalRenderSeconds = 0.0;
+    int numFailed = 0;
+
+    for (auto& result : results)
+    {
+        const auto name = result.file.getRelativePathFrom (settings.inputDirectory);
+
+        if (result.error.isNotEmpty())
+        {
+            std::cerr << name << " " << result.error << std::endl;
+            ++numFailed;
+            continue;
+        }
+
+        std::cout << name << ": " << formatThroughput (result.audioSeconds, result.renderSeconds) << std::endl;
+        totalAudioSeconds += result.audioSeconds;
+        totalRenderSeconds += result.renderSeconds;
+    }
+
+    std::cout << std::endl
+              << "Rendered " << files.size() - numFailed << " files on " << numWorkers << " workers: "
+              << formatThroughput (totalAudioSeconds, wallSeconds) << std::endl
+              << "Per worker: " << formatThroughput (totalAudioSeconds / numWorkers, totalRenderSeconds / numWorkers) << std::endl;
+
+    if (numFailed > 0)
+        juce::ConsoleApplication::fail (juce::String (numFailed) + " files could not be rendered");
+}
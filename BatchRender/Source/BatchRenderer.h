@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Renders every WAV and AIFF file in a directory through
+    BasicChorusAudioProcessor with fixed settings.
+
+    The files are shared out between the workers of a juce::ThreadPool. Each
+    worker owns its own processor, and streams each file through it in large
+    chunks, so memory use doesn't depend on the length of the files. The output
+    has the same length, format and bit depth as the input, with any
+    oversampling latency removed.
+
+    Options:
+        --input=<dir>           the directory to render
+        --output=<dir>          where the rendered files go, under the same names
+        --state=<file>          a saved plugin state to render with
+        --program=N             a program from the preset bank to render with
+        --threads=N             number of workers, one per CPU core by default
+        --chunk-size=N          samples read and processed at a time
+        --recursive             also render the files in subdirectories
+*/
+void runBatchRender (const juce::ArgumentList& args);
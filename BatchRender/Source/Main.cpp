@@ -0,0 +1,27 @@
+/*
+  ==============================================================================
+
+    Offline batch rendering with the basicChorus processor.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "BatchRenderer.h"
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand ("--help|-h", "Usage:", true);
+
+    app.addCommand ({ "--render",
+                      "--render --input=dir --output=dir [--state=file] [--program=N] [--threads=N] [--chunk-size=N] [--recursive]",
+                      "Renders a directory of WAV and AIFF files through the chorus, reporting the throughput.",
+                      {},
+                      [] (const juce::ArgumentList& args) { runBatchRender (args); } });
+
+    return app.findAndRunCommand (argc, argv);
+}
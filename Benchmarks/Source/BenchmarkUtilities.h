@@ -0,0 +1,239 @@
+/*
+  ==============================================================================
+
+    BenchmarkUtilities.h
+
+    Timing, statistics and reporting helpers shared by the benchmarks.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#elif JUCE_WINDOWS
+ #include <windows.h>
+ #include <psapi.h>
+#endif
+
+namespace Benchmark
+{
+
+//==============================================================================
+/** Returns the current time in high-resolution ticks. */
+inline juce::int64 now() noexcept
+{
+    return juce::Time::getHighResolutionTicks();
+}
+
+/** Converts a difference in high-resolution ticks to nanoseconds. */
+inline double ticksToNanoseconds (juce::int64 ticks) noexcept
+{
+    return juce::Time::highResolutionTicksToSeconds (ticks) * 1.0e9;
+}
+
+//==============================================================================
+/**
+    Collects a set of timings and summarises them.
+
+    Storage is reserved up front so that adding a sample inside a timed loop
+    never allocates.
+*/
+class TimingStatistics
+{
+public:
+    explicit TimingStatistics (int expectedNumSamples = 0)
+    {
+        timings.reserve ((size_t) expectedNumSamples);
+    }
+
+    void add (double nanoseconds)          { timings.push_back (nanoseconds); }
+    int size() const noexcept              { return (int) timings.size(); }
+
+    double getTotal() const noexcept
+    {
+        return std::accumulate (timings.begin(), timings.end(), 0.0);
+    }
+
+    double getMean() const noexcept
+    {
+        return timings.empty() ? 0.0 : getTotal() / (double) timings.size();
+    }
+
+    /** Returns the given percentile (0 to 100), using the nearest-rank method. */
+    double getPercentile (double percentile)
+    {
+        if (timings.empty())
+            return 0.0;
+
+        sort();
+
+        const auto rank = (size_t) std::ceil (percentile / 100.0 * (double) timings.size());
+        return timings[juce::jlimit ((size_t) 1, timings.size(), rank) - 1];
+    }
+
+    double getMaximum()
+    {
+        return getPercentile (100.0);
+    }
+
+    /** Returns p50, p99 and max as a JSON object. */
+    juce::var toVar()
+    {
+        auto* object = new juce::DynamicObject();
+        object->setProperty ("p50", getPercentile (50.0));
+        object->setProperty ("p99", getPercentile (99.0));
+        object->setProperty ("max", getMaximum());
+        object->setProperty ("mean", getMean());
+        return object;
+    }
+
+private:
+    void sort()
+    {
+        if (! isSorted)
+            std::sort (timings.begin(), timings.end());
+
+        isSorted = true;
+    }
+
+    std::vector<double> timings;
+    bool isSorted = false;
+};
+
+//==============================================================================
+/** Parses a comma-separated list of numbers from a command line option. */
+template <typename Type>
+std::vector<Type> parseList (const juce::ArgumentList& args, juce::StringRef option, std::vector<Type> defaultValues)
+{
+    if (! args.containsOption (option))
+        return defaultValues;
+
+    std::vector<Type> values;
+
+    for (auto& token : juce::StringArray::fromTokens (args.getValueForOption (option), ",", {}))
+        if (token.trim().isNotEmpty())
+            values.push_back ((Type) token.trim().getDoubleValue());
+
+    return values;
+}
+
+/** Reads a single number from a command line option. */
+inline double getNumber (const juce::ArgumentList& args, juce::StringRef option, double defaultValue)
+{
+    return args.containsOption (option) ? args.getValueForOption (option).getDoubleValue()
+                                        : defaultValue;
+}
+
+/** Writes a JSON report to --output=<file> if given, or stdout otherwise. */
+inline void writeReport (const juce::ArgumentList& args, const juce::var& report)
+{
+    const auto json = juce::JSON::toString (report);
+
+    if (args.containsOption ("--output"))
+    {
+        const auto file = args.getFileForOption ("--output");
+
+        if (! file.replaceWithText (json))
+            juce::ConsoleApplication::fail ("Could not write " + file.getFullPathName());
+
+        return;
+    }
+
+    std::cout << json << std::endl;
+}
+
+/** Returns the resident memory of this process in bytes, or 0 if unknown. */
+inline juce::int64 getResidentMemoryBytes()
+{
+   #if JUCE_LINUX
+    // The second field of statm is the number of resident pages
+    const auto fields = juce::StringArray::fromTokens (juce::File ("/proc/self/statm").loadFileAsString(), false);
+    return fields.size() > 1 ? fields[1].getLargeIntValue() * (juce::int64) sysconf (_SC_PAGESIZE) : 0;
+   #elif JUCE_MAC
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+
+    if (task_info (mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &count) != KERN_SUCCESS)
+        return 0;
+
+    return (juce::int64) info.resident_size;
+   #elif JUCE_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (! GetProcessMemoryInfo (GetCurrentProcess(), &counters, sizeof (counters)))
+        return 0;
+
+    return (juce::int64) counters.WorkingSetSize;
+   #else
+    return 0;
+   #endif
+}
+
+//==============================================================================
+/** The parameters that pick which processing pipeline runs, rather than
+    changing the sound within one. They're never randomised, so that timings
+    from different runs are of the same code.
+*/
+inline bool isPipelineParameter (juce::AudioProcessorParameter& parameter)
+{
+    if (auto* withId = dynamic_cast<juce::AudioProcessorParameterWithID*> (&parameter))
+        return withId->paramID == "OVERSAMPLING" || withId->paramID == "OVERSAMPLINGFILTER"
+                || withId->paramID == "INTERPOLATION";
+
+    return false;
+}
+
+/** Gives every parameter of a processor, apart from the pipeline parameters,
+    a random value, as a host would.
+*/
+inline void randomiseParameters (juce::AudioProcessor& processor, juce::Random& random)
+{
+    for (auto* parameter : processor.getParameters())
+        if (! isPipelineParameter (*parameter))
+            parameter->setValueNotifyingHost (random.nextFloat());
+}
+
+/** Moves every parameter of a processor a host would automate during
+    playback, keeping to changes that are glided to rather than crossfaded
+    onto a second engine: the pipeline parameters, the number of voices and
+    the LFO shape are left alone, and the centre delay only moves by up to
+    maxCentreDelayStepMs either way.
+*/
+inline void glideParameters (juce::AudioProcessor& processor, juce::Random& random, float maxCentreDelayStepMs)
+{
+    for (auto* parameter : processor.getParameters())
+    {
+        auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter);
+
+        if (ranged == nullptr || isPipelineParameter (*parameter)
+             || ranged->paramID == "VOICES" || ranged->paramID == "LFOSHAPE")
+            continue;
+
+        if (ranged->paramID == "CENTREDELAY")
+        {
+            const auto& range = ranged->getNormalisableRange();
+            const auto step = maxCentreDelayStepMs * (2.0f * random.nextFloat() - 1.0f);
+            const auto newDelay = juce::jlimit (range.start, range.end, ranged->convertFrom0to1 (ranged->getValue()) + step);
+            ranged->setValueNotifyingHost (ranged->convertTo0to1 (newDelay));
+            continue;
+        }
+
+        parameter->setValueNotifyingHost (random.nextFloat());
+    }
+}
+
+/** Sets a choice parameter of an AudioProcessorValueTreeState to an index. */
+inline void setChoice (juce::AudioProcessorValueTreeState& apvts, juce::StringRef parameterId, int index)
+{
+    auto* parameter = apvts.getParameter (parameterId);
+    jassert (parameter != nullptr);
+    parameter->setValueNotifyingHost (parameter->convertTo0to1 ((float) index));
+}
+
+} // namespace Benchmark
@@ -0,0 +1,143 @@
+/*
+  ==============================================================================
+
+    InstanceBenchmark.cpp
+
+  ==============================================================================
+*/
+
+#include "InstanceBenchmark.h"
+#include "BenchmarkUtilities.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    struct Configuration
+    {
+        int numInstances;
+        double sampleRate;
+        int blockSize;
+        int numChannels;
+        double secondsPerRun;
+    };
+
+    /** One open instance: a processor with its own buffer, as on a track. */
+    struct Instance
+    {
+        std::unique_ptr<BasicChorusAudioProcessor> processor;
+        juce::AudioBuffer<float> buffer;
+    };
+
+    juce::var runConfiguration (const Configuration& config, juce::Random& random)
+    {
+        const auto baselineMemory = Benchmark::getResidentMemoryBytes();
+
+        std::vector<Instance> instances ((size_t) config.numInstances);
+        Benchmark::TimingStatistics constructionTimes (config.numInstances), prepareTimes (config.numInstances);
+
+        for (auto& instance : instances)
+        {
+            const auto start = Benchmark::now();
+            instance.processor = std::make_unique<BasicChorusAudioProcessor>();
+            constructionTimes.add (Benchmark::ticksToNanoseconds (Benchmark::now() - start));
+        }
+
+        const auto constructedMemory = Benchmark::getResidentMemoryBytes();
+
+        for (auto& instance : instances)
+        {
+            auto& processor = *instance.processor;
+            processor.setPlayConfigDetails (config.numChannels, config.numChannels, config.sampleRate, config.blockSize);
+
+            const auto start = Benchmark::now();
+            processor.prepareToPlay (config.sampleRate, config.blockSize);
+            prepareTimes.add (Benchmark::ticksToNanoseconds (Benchmark::now() - start));
+
+            // Every instance gets different settings, so they don't all share
+            // one code path, and a busy input, so none of them go idle.
+            Benchmark::randomiseParameters (processor, random);
+            instance.buffer.setSize (config.numChannels, config.blockSize);
+        }
+
+        const auto preparedMemory = Benchmark::getResidentMemoryBytes();
+
+        juce::AudioBuffer<float> input (config.numChannels, config.blockSize);
+        juce::MidiBuffer midi;
+
+        for (int channel = 0; channel < config.numChannels; ++channel)
+            for (int i = 0; i < config.blockSize; ++i)
+                input.setSample (channel, i, random.nextFloat() * 2.0f - 1.0f);
+
+        const auto numRounds = juce::jmax (16, (int) std::ceil (config.secondsPerRun * config.sampleRate / config.blockSize));
+        const auto numWarmUpRounds = juce::jmax (4, numRounds / 20);
+        const auto blockNanoseconds = config.blockSize / config.sampleRate * 1.0e9;
+
+        Benchmark::TimingStatistics roundTimes (numRounds);
+
+        for (int round = -numWarmUpRounds; round < numRounds; ++round)
+        {
+            for (auto& instance : instances)
+                instance.buffer.makeCopyOf (input, true);
+
+            const auto start = Benchmark::now();
+
+            for (auto& instance : instances)
+                instance.processor->processBlock (instance.buffer, midi);
+
+            const auto end = Benchmark::now();
+
+            if (round >= 0)
+                roundTimes.add (Benchmark::ticksToNanoseconds (end - start));
+        }
+
+        for (auto& instance : instances)
+            instance.processor->releaseResources();
+
+        const auto perInstance = [&] (juce::int64 bytes) { return (double) bytes / (double) config.numInstances; };
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("numInstances", config.numInstances);
+        result->setProperty ("constructionTimeNs", constructionTimes.toVar());
+        result->setProperty ("prepareTimeNs", prepareTimes.toVar());
+        result->setProperty ("constructedBytesPerInstance", perInstance (constructedMemory - baselineMemory));
+        result->setProperty ("preparedBytesPerInstance", perInstance (preparedMemory - baselineMemory));
+        result->setProperty ("roundTimeNs", roundTimes.toVar());
+        result->setProperty ("roundTimeNsPerInstance", roundTimes.getMean() / config.numInstances);
+        result->setProperty ("cpuLoad", roundTimes.getMean() / blockNanoseconds);
+        result->setProperty ("peakCpuLoad", roundTimes.getMaximum() / blockNanoseconds);
+        return result;
+    }
+}
+
+//==============================================================================
+void runInstanceBenchmark (const juce::ArgumentList& args)
+{
+    const auto instanceCounts = Benchmark::parseList<int> (args, "--counts", { 1, 10, 50, 100, 200, 300, 500 });
+    const auto sampleRate     = Benchmark::getNumber (args, "--sample-rate", 48000.0);
+    const auto blockSize      = (int) Benchmark::getNumber (args, "--block-size", 256);
+    const auto numChannels    = (int) Benchmark::getNumber (args, "--channels", 2);
+    const auto seconds        = Benchmark::getNumber (args, "--seconds", 2.0);
+
+    if (sampleRate <= 0.0 || blockSize <= 0)
+        juce::ConsoleApplication::fail ("The sample rate and block size must be positive");
+
+    juce::Random random (1);
+    juce::Array<juce::var> results;
+
+    for (auto numInstances : instanceCounts)
+    {
+        if (numInstances <= 0)
+            juce::ConsoleApplication::fail ("Instance counts must be positive");
+
+        results.add (runConfiguration ({ numInstances, sampleRate, blockSize, numChannels, seconds }, random));
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty ("benchmark", "instances");
+    report->setProperty ("sampleRate", sampleRate);
+    report->setProperty ("blockSize", blockSize);
+    report->setProperty ("numChannels", numChannels);
+    report->setProperty ("results", results);
+
+    Benchmark::writeReport (args, report);
+}
@@ -0,0 +1,37 @@
+/*
+  ==============================================================================
+
+    InstanceBenchmark.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Measures what each BasicChorusAudioProcessor costs when many are open, as
+    in a large session template.
+
+    For each instance count, that many processors are created and prepared, and
+    then processed round-robin, one block each in turn, as a host would. The
+    report gives the resident memory added per instance, the construction and
+    prepareToPlay times, and the time taken by each round as a fraction of the
+    block's duration. Oversampling and interpolation stay at their defaults, so
+    every instance runs the same pipeline.
+
+    Resident memory is read from the OS, and memory freed after one instance
+    count may be reused by the next, so for exact figures run one count at a
+    time.
+
+    Options:
+        --counts=1,10,100,...           numbers of instances to test
+        --sample-rate=N                 sample rate to run at
+        --block-size=N                  block size to run at
+        --channels=N                    number of input and output channels
+        --seconds=N                     audio rendered per instance count
+        --output=<file>                 write the JSON report to a file
+*/
+void runInstanceBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    LfoBenchmark.cpp
+
+  ==============================================================================
+*/
+
+#include "LfoBenchmark.h"
+#include "BenchmarkUtilities.h"
+#include "../../Source/ChorusLfo.h"
+
+namespace
+{
+    using SIMDFloat = ChorusLfo::SIMDFloat;
+
+    constexpr int maxVoices = 8;
+    constexpr int numLanes = (int) SIMDFloat::SIMDNumElements;
+    constexpr float rateHz = 1.3f;
+
+    /** One juce::dsp::Oscillator per voice, set up as juce::dsp::Chorus does. */
+    double timeJuceOscillators (int numVoices, double sampleRate, int numSamples, float& sink)
+    {
+        std::vector<std::unique_ptr<juce::dsp::Oscillator<float>>> oscillators;
+
+        for (int voice = 0; voice < numVoices; ++voice)
+        {
+            auto oscillator = std::make_unique<juce::dsp::Oscillator<float>>();
+            oscillator->initialise ([] (float x) { return std::sin (x); });
+            oscillator->prepare ({ sampleRate, 512, 1 });
+            oscillator->setFrequency (rateHz, true);
+            oscillators.push_back (std::move (oscillator));
+        }
+
+        auto sum = 0.0f;
+        const auto start = Benchmark::now();
+
+        for (int i = 0; i < numSamples; ++i)
+            for (auto& oscillator : oscillators)
+                sum += oscillator->processSample (0.0f);
+
+        const auto end = Benchmark::now();
+        sink += sum;
+
+        return Benchmark::ticksToNanoseconds (end - start);
+    }
+
+    double timeChorusLfo (ChorusLfo::Shape shape, int numVoices, double sampleRate, int numSamples, float& sink)
+    {
+        ChorusLfo lfo;
+        lfo.prepare (sampleRate);
+        lfo.setShape (shape);
+
+        const auto numGroups = (numVoices + numLanes - 1) / numLanes;
+        SIMDFloat offsets[(maxVoices + numLanes - 1) / numLanes];
+
+        for (int voice = 0; voice < numGroups * numLanes; ++voice)
+            offsets[voice / numLanes].set ((size_t) (voice % numLanes), (float) voice / (float) numVoices);
+
+        auto sum = SIMDFloat::expand (0.0f);
+        const auto start = Benchmark::now();
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            for (int group = 0; group < numGroups; ++group)
+                sum += lfo.getValues (offsets[group]);
+
+            lfo.advance (rateHz);
+        }
+
+        const auto end = Benchmark::now();
+        sink += sum.sum();
+
+        return Benchmark::ticksToNanoseconds (end - start);
+    }
+}
+
+//==============================================================================
+void runLfoBenchmark (const juce::ArgumentList& args)
+{
+    const auto sampleRate = Benchmark::getNumber (args, "--sample-rate", 192000.0);
+    const auto seconds    = Benchmark::getNumber (args, "--seconds", 2.0);
+    const auto numSamples = juce::jmax (1, (int) (seconds * sampleRate));
+
+    const std::pair<ChorusLfo::Shape, const char*> shapes[] = { { ChorusLfo::Shape::sine,           "sine" },
+                                                                { ChorusLfo::Shape::triangle,       "triangle" },
+                                                                { ChorusLfo::Shape::smoothedRandom, "smoothedRandom" } };
+
+    float sink = 0.0f;
+    juce::Array<juce::var> results;
+
+    for (int numVoices = 1; numVoices <= maxVoices; numVoices *= 2)
+    {
+        const auto juceNanoseconds = timeJuceOscillators (numVoices, sampleRate, numSamples, sink);
+
+        for (auto& shape : shapes)
+        {
+            const auto lfoNanoseconds = timeChorusLfo (shape.first, numVoices, sampleRate, numSamples, sink);
+
+            auto* result = new juce::DynamicObject();
+            result->setProperty ("shape", shape.second);
+            result->setProperty ("numVoices", numVoices);
+            result->setProperty ("juceOscillatorNsPerSample", juceNanoseconds / numSamples);
+            result->setProperty ("chorusLfoNsPerSample", lfoNanoseconds / numSamples);
+            result->setProperty ("speedup", juceNanoseconds / lfoNanoseconds);
+            results.add (result);
+        }
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty ("benchmark", "lfo");
+    report->setProperty ("sampleRate", sampleRate);
+    report->setProperty ("results", results);
+    report->setProperty ("checksum", sink);
+
+    Benchmark::writeReport (args, report);
+}
@@ -0,0 +1,23 @@
+/*
+  ==============================================================================
+
+    LfoBenchmark.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Compares the cost of ChorusLfo with the juce::dsp::Oscillator that
+    juce::dsp::Chorus uses, for each LFO shape and voice count.
+
+    Options:
+        --sample-rate=N         sample rate to run at
+        --seconds=N             audio rendered per measurement
+        --output=<file>         write the JSON report to a file
+*/
+void runLfoBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    Command line benchmarks for the basicChorus processor.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "ProcessBlockBenchmark.h"
+#include "LfoBenchmark.h"
+#include "InstanceBenchmark.h"
+#include "StartupBenchmark.h"
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand ("--help|-h", "Usage:", true);
+
+    app.addCommand ({ "--process-block",
+                      "--process-block [--sample-rates=a,b,..] [--block-sizes=a,b,..] [--channels=N] [--seconds=N] [--events-per-block=N] [--oversampling=a,b,..] [--interpolation=a,b,..] [--voices=a,b,..] [--seed=N] [--output=file]",
+                      "Times processBlock across sample rates and block sizes, writing a JSON report.",
+                      {},
+                      [] (const juce::ArgumentList& args) { runProcessBlockBenchmark (args); } });
+
+    app.addCommand ({ "--lfo",
+                      "--lfo [--sample-rate=N] [--seconds=N] [--output=file]",
+                      "Compares ChorusLfo against juce::dsp::Oscillator, writing a JSON report.",
+                      {},
+                      [] (const juce::ArgumentList& args) { runLfoBenchmark (args); } });
+
+    app.addCommand ({ "--instances",
+                      "--instances [--counts=a,b,..] [--sample-rate=N] [--block-size=N] [--channels=N] [--seconds=N] [--output=file]",
+                      "Measures per-instance memory, setup time and round-robin CPU load as the instance count grows, writing a JSON report.",
+                      {},
+                      [] (const juce::ArgumentList& args) { runInstanceBenchmark (args); } });
+
+    app.addCommand ({ "--startup",
+                      "--startup [--runs=N] [--sample-rate=N] [--block-size=N] [--output=file]",
+                      "Times construction, createParameters, prepareToPlay, createEditor and the first paint, writing a JSON report.",
+                      {},
+                      [] (const juce::ArgumentList& args) { runStartupBenchmark (args); } });
+
+    return app.findAndRunCommand (argc, argv);
+}
@@ -0,0 +1,168 @@
+/*
+  ==============================================================================
+
+    ProcessBlockBenchmark.cpp
+
+  ==============================================================================
+*/
+
+#include "ProcessBlockBenchmark.h"
+#include "BenchmarkUtilities.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    struct Configuration
+    {
+        double sampleRate;
+        int blockSize;
+        int numChannels;
+        double secondsPerRun;
+        double secondsBetweenParameterChanges;
+        int eventsPerBlock;
+        int oversampling;
+        int interpolation;
+        int numVoices;
+    };
+
+    /** Queues evenly spaced sample-accurate events, as dense automation would. */
+    void addParameterEvents (BasicChorusAudioProcessor& processor, const Configuration& config, juce::Random& random)
+    {
+        using EventParameter = BasicChorusAudioProcessor::EventParameter;
+
+        for (int event = 0; event < config.eventsPerBlock; ++event)
+        {
+            const auto offset = event * config.blockSize / config.eventsPerBlock;
+
+            switch (event % 3)
+            {
+                case 0:  processor.addParameterEvent (EventParameter::centreDelay, offset, 1.0f + 99.0f * random.nextFloat()); break;
+                case 1:  processor.addParameterEvent (EventParameter::depth, offset, random.nextFloat()); break;
+                default: processor.addParameterEvent (EventParameter::mix, offset, random.nextFloat()); break;
+            }
+        }
+    }
+
+    juce::var runConfiguration (const Configuration& config, juce::Random& random)
+    {
+        BasicChorusAudioProcessor processor;
+        Benchmark::setChoice (processor.apvts, "OVERSAMPLING", config.oversampling);
+        Benchmark::setChoice (processor.apvts, "INTERPOLATION", config.interpolation);
+
+        auto* voices = processor.apvts.getParameter ("VOICES");
+        voices->setValueNotifyingHost (voices->convertTo0to1 ((float) config.numVoices));
+        processor.setPlayConfigDetails (config.numChannels, config.numChannels, config.sampleRate, config.blockSize);
+        processor.prepareToPlay (config.sampleRate, config.blockSize);
+
+        juce::AudioBuffer<float> input (config.numChannels, config.blockSize);
+        juce::AudioBuffer<float> buffer (config.numChannels, config.blockSize);
+        juce::MidiBuffer midi;
+
+        for (int channel = 0; channel < config.numChannels; ++channel)
+            for (int i = 0; i < config.blockSize; ++i)
+                input.setSample (channel, i, random.nextFloat() * 2.0f - 1.0f);
+
+        const auto numBlocks = juce::jmax (16, (int) std::ceil (config.secondsPerRun * config.sampleRate / config.blockSize));
+        const auto blocksBetweenChanges = juce::jmax (1, (int) (config.secondsBetweenParameterChanges * config.sampleRate / config.blockSize));
+        const auto numWarmUpBlocks = juce::jmax (4, numBlocks / 20);
+
+        Benchmark::TimingStatistics blockTimes (numBlocks);
+
+        for (int block = -numWarmUpBlocks; block < numBlocks; ++block)
+        {
+            // Only changes the processor glides to are made, so no timed block
+            // includes a crossfade. The centre delay moves by up to half the
+            // glide limit, which its rounding to whole milliseconds can't exceed.
+            if (block % blocksBetweenChanges == 0)
+                Benchmark::glideParameters (processor, random, 0.5f * BasicChorusAudioProcessor::maxGlideDelayMs);
+
+            buffer.makeCopyOf (input, true);
+            addParameterEvents (processor, config, random);
+
+            const auto start = Benchmark::now();
+            processor.processBlock (buffer, midi);
+            const auto end = Benchmark::now();
+
+            if (block >= 0)
+                blockTimes.add (Benchmark::ticksToNanoseconds (end - start));
+        }
+
+        processor.releaseResources();
+
+        const auto totalSamples = (double) numBlocks * config.blockSize;
+        const auto totalNanoseconds = blockTimes.getTotal();
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("sampleRate", config.sampleRate);
+        result->setProperty ("blockSize", config.blockSize);
+        result->setProperty ("numChannels", config.numChannels);
+        result->setProperty ("numBlocks", numBlocks);
+        result->setProperty ("eventsPerBlock", config.eventsPerBlock);
+        result->setProperty ("oversampling", config.oversampling);
+        result->setProperty ("interpolation", config.interpolation);
+        result->setProperty ("voices", config.numVoices);
+        result->setProperty ("nsPerSample", totalNanoseconds / totalSamples);
+        result->setProperty ("blockTimeNs", blockTimes.toVar());
+        result->setProperty ("realtimeFactor", (totalSamples / config.sampleRate) / (totalNanoseconds * 1.0e-9));
+        return result;
+    }
+}
+
+//==============================================================================
+void runProcessBlockBenchmark (const juce::ArgumentList& args)
+{
+    const auto sampleRates = Benchmark::parseList<double> (args, "--sample-rates", { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 });
+    const auto blockSizes  = Benchmark::parseList<int> (args, "--block-sizes", { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 });
+    const auto seconds     = Benchmark::getNumber (args, "--seconds", 2.0);
+    const auto seed        = (juce::int64) Benchmark::getNumber (args, "--seed", 1);
+    const auto numChannels = (int) Benchmark::getNumber (args, "--channels", 2);
+    const auto eventsPerBlock = (int) Benchmark::getNumber (args, "--events-per-block", 0);
+    const auto oversamplings  = Benchmark::parseList<int> (args, "--oversampling", { 0 });
+    const auto interpolations = Benchmark::parseList<int> (args, "--interpolation", { 0 });
+    const auto voiceCounts    = Benchmark::parseList<int> (args, "--voices", { 1 });
+
+    juce::Random random (seed);
+    juce::Array<juce::var> results;
+
+    for (auto oversampling : oversamplings)
+        if (! juce::isPositiveAndBelow (oversampling, 3))
+            juce::ConsoleApplication::fail ("Oversampling must be 0 (off), 1 (2x) or 2 (4x)");
+
+    for (auto interpolation : interpolations)
+        if (! juce::isPositiveAndBelow (interpolation, 3))
+            juce::ConsoleApplication::fail ("Interpolation must be 0 (linear), 1 (Lagrange) or 2 (Thiran)");
+
+    for (auto numVoices : voiceCounts)
+        if (numVoices < 1 || numVoices > ChorusEngineBase::maxVoices)
+            juce::ConsoleApplication::fail ("The number of voices must be from 1 to " + juce::String (ChorusEngineBase::maxVoices));
+
+    // The pipeline and the number of voices are dimensions of the grid; within
+    // a run only the parameters that can be glided to are moved.
+    for (auto oversampling : oversamplings)
+    {
+        for (auto interpolation : interpolations)
+        {
+            for (auto numVoices : voiceCounts)
+            {
+                for (auto sampleRate : sampleRates)
+                {
+                    for (auto blockSize : blockSizes)
+                    {
+                        if (sampleRate <= 0.0 || blockSize <= 0)
+                            juce::ConsoleApplication::fail ("Sample rates and block sizes must be positive");
+
+                        results.add (runConfiguration ({ sampleRate, blockSize, numChannels, seconds, 0.1, eventsPerBlock,
+                                                         oversampling, interpolation, numVoices }, random));
+                    }
+                }
+            }
+        }
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty ("benchmark", "processBlock");
+    report->setProperty ("seed", seed);
+    report->setProperty ("results", results);
+
+    Benchmark::writeReport (args, report);
+}
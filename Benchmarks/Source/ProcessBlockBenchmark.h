@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    ProcessBlockBenchmark.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Times BasicChorusAudioProcessor::processBlock over a grid of oversampling
+    factors, interpolation kernels, voice counts, sample rates and block sizes.
+    The other parameters move as the benchmark runs, apart from the LFO shape,
+    but only by changes the processor glides to, so no timed block includes a
+    crossfade between engines.
+
+    Options:
+        --sample-rates=44100,48000,...   sample rates to test
+        --block-sizes=1,2,4,...          block sizes to test
+        --channels=N                     number of input and output channels
+        --seconds=N                      audio rendered per combination
+        --events-per-block=N             sample-accurate parameter events per block
+        --oversampling=0,1,2             oversampling choices to test (off, 2x, 4x)
+        --interpolation=0,1,2            interpolation choices to test (linear, Lagrange, Thiran)
+        --voices=1,2,...                 numbers of voices to test
+        --seed=N                         seed for the parameter randomisation
+        --output=<file>                  write the JSON report to a file
+*/
+void runProcessBlockBenchmark (const juce::ArgumentList& args);
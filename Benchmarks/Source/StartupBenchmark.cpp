@@ -0,0 +1,119 @@
+/*
+  ==============================================================================
+
+    StartupBenchmark.cpp
+
+  ==============================================================================
+*/
+
+#include "StartupBenchmark.h"
+#include "BenchmarkUtilities.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    using Stage = StartupProfile::Stage;
+
+    constexpr int numStages = (int) Stage::numStages;
+
+    /** The stage timings and editor open time of one run, in milliseconds. */
+    struct RunTimes
+    {
+        double stageMs[numStages];
+        double editorOpenMs;
+    };
+
+    RunTimes bringUpProcessor (double sampleRate, int blockSize)
+    {
+        auto processor = std::make_unique<BasicChorusAudioProcessor>();
+        processor->setPlayConfigDetails (2, 2, sampleRate, blockSize);
+        processor->prepareToPlay (sampleRate, blockSize);
+
+        {
+            std::unique_ptr<juce::AudioProcessorEditor> editor (processor->createEditorAndMakeActive());
+
+            // Painting into an image runs the same code as a first paint on
+            // screen, without needing a window.
+            juce::Image image (juce::Image::ARGB, editor->getWidth(), editor->getHeight(), true);
+            juce::Graphics g (image);
+            editor->paintEntireComponent (g, true);
+        }
+
+        processor->releaseResources();
+
+        const auto& profile = processor->getStartupProfile();
+        RunTimes times;
+
+        for (int i = 0; i < numStages; ++i)
+        {
+            const auto timestamp = profile.getTimestamp ((Stage) i);
+
+            if (! timestamp.wasRecorded())
+                juce::ConsoleApplication::fail (juce::String ("The ") + StartupProfile::getStageName ((Stage) i) + " stage was never recorded");
+
+            times.stageMs[i] = timestamp.durationMs;
+        }
+
+        const auto createEditor = profile.getTimestamp (Stage::createEditor);
+        const auto firstPaint = profile.getTimestamp (Stage::firstPaint);
+        times.editorOpenMs = firstPaint.startMs + firstPaint.durationMs - createEditor.startMs;
+        return times;
+    }
+
+    juce::var toVar (const RunTimes& times)
+    {
+        auto* object = new juce::DynamicObject();
+
+        for (int i = 0; i < numStages; ++i)
+            object->setProperty (StartupProfile::getStageName ((Stage) i), times.stageMs[i]);
+
+        object->setProperty ("editorOpen", times.editorOpenMs);
+        return object;
+    }
+}
+
+//==============================================================================
+void runStartupBenchmark (const juce::ArgumentList& args)
+{
+    const auto numRuns    = (int) Benchmark::getNumber (args, "--runs", 50);
+    const auto sampleRate = Benchmark::getNumber (args, "--sample-rate", 48000.0);
+    const auto blockSize  = (int) Benchmark::getNumber (args, "--block-size", 256);
+
+    if (numRuns <= 0 || sampleRate <= 0.0 || blockSize <= 0)
+        juce::ConsoleApplication::fail ("The number of runs, sample rate and block size must be positive");
+
+    std::vector<Benchmark::TimingStatistics> stageTimes ((size_t) numStages);
+    Benchmark::TimingStatistics editorOpenTimes (numRuns);
+    juce::var firstRun;
+
+    for (int run = 0; run < numRuns; ++run)
+    {
+        const auto times = bringUpProcessor (sampleRate, blockSize);
+
+        if (run == 0)
+            firstRun = toVar (times);
+
+        for (int i = 0; i < numStages; ++i)
+            stageTimes[(size_t) i].add (times.stageMs[i]);
+
+        editorOpenTimes.add (times.editorOpenMs);
+    }
+
+    auto* stages = new juce::DynamicObject();
+
+    for (int i = 0; i < numStages; ++i)
+        stages->setProperty (StartupProfile::getStageName ((Stage) i), stageTimes[(size_t) i].toVar());
+
+    stages->setProperty ("editorOpen", editorOpenTimes.toVar());
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty ("benchmark", "startup");
+    report->setProperty ("units", "ms");
+    report->setProperty ("numRuns", numRuns);
+    report->setProperty ("sampleRate", sampleRate);
+    report->setProperty ("blockSize", blockSize);
+    report->setProperty ("firstRun", firstRun);
+    report->setProperty ("stages", stages);
+
+    Benchmark::writeReport (args, report);
+}
@@ -0,0 +1,31 @@
+/*
+  ==============================================================================
+
+    StartupBenchmark.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Measures how long it takes to bring up a BasicChorusAudioProcessor and open
+    its editor, as a host does when loading a session.
+
+    Each run creates a processor, prepares it, creates its editor and paints
+    the editor once into an image, then deletes both. The report gives each
+    stage of the processor's StartupProfile, and the editor open time from the
+    start of createEditor() to the end of the first paint. The first run is
+    also reported on its own, as it's the only one that pays for the editor's
+    shared resources.
+
+    Options:
+        --runs=N                        number of processors to bring up
+        --sample-rate=N                 sample rate to prepare at
+        --block-size=N                  block size to prepare at
+        --output=<file>                 write the JSON report to a file
+*/
+void runStartupBenchmark (const juce::ArgumentList& args);
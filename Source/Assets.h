@@ -1,9 +0,0 @@
-/* (Auto-generated binary data file). */
-
-#pragma once
-
-namespace Assets
-{
-    extern const char*  Lockup_3_Curves_png;
-    const int           Lockup_3_Curves_pngSize = 30362;
-}
@@ -0,0 +1,535 @@
+/*
+  ==============================================================================
+
+    ChorusEngine.cpp
+
+  ==============================================================================
+*/
+
+#include "ChorusEngine.h"
+
+//==============================================================================
+template <typename SampleType>
+ChorusEngine<SampleType>::ChorusEngine()
+{
+    rate.setTargetValue (1.0f);
+    depth.setTargetValue (0.25f);
+    centreDelay.setTargetValue (7.0f);
+    mix.setTargetValue (0.5f);
+
+    updateVoiceLayout();
+}
+
+//==============================================================================
+template <typename SampleType>
+void ChorusEngine<SampleType>::setMaximumDelay (float newMaximumDelayMs)
+{
+    jassert (newMaximumDelayMs > 0.0f && newMaximumDelayMs <= maxCentreDelayMs + maxDepthMs);
+    maximumDelayMs = juce::jlimit (1.0f, maxCentreDelayMs + maxDepthMs, newMaximumDelayMs);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::prepare (const juce::dsp::ProcessSpec& spec)
+{
+    jassert (spec.sampleRate > 0);
+    jassert (spec.numChannels > 0 && spec.numChannels <= (juce::uint32) maxChannels);
+
+    sampleRate = preparedSampleRate = spec.sampleRate;
+    maximumBlockSize = (int) spec.maximumBlockSize;
+
+    lfo.prepare (sampleRate);
+
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->prepare (sampleRate, maximumBlockSize);
+
+    updateDelayLength();
+    delayLineStride = delayBufferSize;
+
+    numChannels = juce::jmin ((int) spec.numChannels, maxChannels);
+    numChannelGroups = (numChannels + numLanes - 1) / numLanes;
+    useChannelGroups = numChannels >= numLanes;
+
+    // Only the delay lines for the chosen layout are kept
+    if (useChannelGroups)
+    {
+        delayLines.clear();
+        delayLines.shrink_to_fit();
+        interleavedDelay.resize ((size_t) (numChannelGroups * delayLineStride));
+        allpassStates.resize ((size_t) (numChannelGroups * maxVoices));
+    }
+    else
+    {
+        interleavedDelay.clear();
+        interleavedDelay.shrink_to_fit();
+        delayLines.resize ((size_t) (numChannels * delayLineStride));
+        allpassStates.resize ((size_t) (numChannels * maxVoiceGroups));
+    }
+
+    lastWet.resize ((size_t) numChannels);
+    lastWetGroups.resize ((size_t) numChannelGroups);
+    channelPhaseOffsets.resize ((size_t) numChannelGroups);
+    updateChannelPhaseOffsets();
+
+    reset();
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::release()
+{
+    for (auto* buffer : { &delayLines, &lastWet })
+    {
+        buffer->clear();
+        buffer->shrink_to_fit();
+    }
+
+    for (auto* buffer : { &interleavedDelay, &lastWetGroups, &allpassStates, &channelPhaseOffsets })
+    {
+        buffer->clear();
+        buffer->shrink_to_fit();
+    }
+
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->release();
+
+    numChannels = numChannelGroups = 0;
+    delayLineStride = delayBufferSize = delayMask = writePosition = 0;
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::reset()
+{
+    // Only the part of each line used at the current rate is ever read
+    for (size_t start = 0; start < delayLines.size(); start += (size_t) delayLineStride)
+        std::fill_n (delayLines.begin() + (std::ptrdiff_t) start, delayBufferSize, (SampleType) 0);
+
+    for (size_t start = 0; start < interleavedDelay.size(); start += (size_t) delayLineStride)
+        std::fill_n (interleavedDelay.begin() + (std::ptrdiff_t) start, delayBufferSize, SIMDType::expand ((SampleType) 0));
+
+    std::fill (lastWet.begin(), lastWet.end(), (SampleType) 0);
+    std::fill (lastWetGroups.begin(), lastWetGroups.end(), SIMDType::expand ((SampleType) 0));
+    std::fill (allpassStates.begin(), allpassStates.end(), SIMDType::expand ((SampleType) 0));
+    writePosition = 0;
+    wetPeak = 0;
+    lfo.reset();
+
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->reset();
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setSampleRate (double newSampleRate) noexcept
+{
+    jassert (newSampleRate > 0 && newSampleRate <= preparedSampleRate);
+
+    sampleRate = juce::jmin (newSampleRate, preparedSampleRate);
+    lfo.setSampleRate (sampleRate);
+
+    updateDelayLength();
+    writePosition &= delayMask;
+
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->setSampleRate (sampleRate);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::continueFrom (const ChorusEngine& other) noexcept
+{
+    jassert (other.numChannels == numChannels && other.delayLineStride == delayLineStride);
+
+    jassert (other.delayBufferSize == delayBufferSize);
+
+    for (size_t start = 0; start < delayLines.size(); start += (size_t) delayLineStride)
+        std::copy_n (other.delayLines.begin() + (std::ptrdiff_t) start, delayBufferSize, delayLines.begin() + (std::ptrdiff_t) start);
+
+    for (size_t start = 0; start < interleavedDelay.size(); start += (size_t) delayLineStride)
+        std::copy_n (other.interleavedDelay.begin() + (std::ptrdiff_t) start, delayBufferSize, interleavedDelay.begin() + (std::ptrdiff_t) start);
+
+    std::copy (other.lastWet.begin(), other.lastWet.end(), lastWet.begin());
+    std::copy (other.lastWetGroups.begin(), other.lastWetGroups.end(), lastWetGroups.begin());
+    std::copy (other.allpassStates.begin(), other.allpassStates.end(), allpassStates.begin());
+    writePosition = other.writePosition;
+    lfo.copyPhaseFrom (other.lfo);
+
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->reset();
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::continueModulationFrom (const ChorusEngine& other) noexcept
+{
+    lfo.copyPhaseFrom (other.lfo);
+
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->reset();
+}
+
+//==============================================================================
+template <typename SampleType>
+float ChorusEngine<SampleType>::getModulatedDelayMs() const noexcept
+{
+    // The first voice and the first channel both have no phase offset
+    const auto modulation = (float) lfo.getValues (SIMDType::expand ((SampleType) 0)).get (0);
+
+    return centreDelay.getCurrentValue() + depth.getCurrentValue() * maxDepthMs * modulation;
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setRate (float newRateHz)
+{
+    jassert (juce::isPositiveAndBelow (newRateHz, 100.0f));
+    rate.setTargetValue (newRateHz);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setDepth (float newDepth)
+{
+    jassert (newDepth >= 0.0f && newDepth <= 1.0f);
+    depth.setTargetValue (newDepth);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setCentreDelay (float newDelayMs)
+{
+    jassert (newDelayMs >= 1.0f && newDelayMs <= maxCentreDelayMs);
+    centreDelay.setTargetValue (juce::jlimit (1.0f, maxCentreDelayMs, newDelayMs));
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setFeedback (float newFeedback)
+{
+    jassert (newFeedback >= -1.0f && newFeedback <= 1.0f);
+    feedback.setTargetValue (newFeedback);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setMix (float newMix)
+{
+    jassert (newMix >= 0.0f && newMix <= 1.0f);
+    mix.setTargetValue (newMix);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setLfoShape (ChorusLfo::Shape newShape)
+{
+    lfo.setShape (newShape);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setInterpolation (Interpolation newInterpolation)
+{
+    if (interpolation == newInterpolation)
+        return;
+
+    interpolation = newInterpolation;
+    std::fill (allpassStates.begin(), allpassStates.end(), SIMDType::expand ((SampleType) 0));
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setHighPrecisionLfo (bool shouldUseHighPrecision)
+{
+    lfo.setHighPrecision (shouldUseHighPrecision);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setChannelSpread (float newSpread)
+{
+    jassert (newSpread >= 0.0f && newSpread <= 1.0f);
+    channelSpread = juce::jlimit (0.0f, 1.0f, newSpread);
+    updateChannelPhaseOffsets();
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setNumVoices (int newNumVoices)
+{
+    jassert (newNumVoices >= 1 && newNumVoices <= maxVoices);
+    numVoices = juce::jlimit (1, maxVoices, newNumVoices);
+    updateVoiceLayout();
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setWetPeakTracking (bool shouldTrack) noexcept
+{
+    // A peak left over from before tracking was last turned off is stale
+    if (shouldTrack && ! trackWetPeak)
+        wetPeak = 0;
+
+    trackWetPeak = shouldTrack;
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::setRampLength (double newRampLengthSeconds)
+{
+    for (auto* ramp : { &rate, &depth, &centreDelay, &feedback, &mix })
+        ramp->setRampLength (newRampLengthSeconds);
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::updateVoiceLayout() noexcept
+{
+    numVoiceGroups = (numVoices + numLanes - 1) / numLanes;
+
+    const auto gain = (SampleType) 1 / (SampleType) numVoices;
+
+    for (int group = 0; group < maxVoiceGroups; ++group)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const auto voice = group * numLanes + lane;
+            const auto isActive = voice < numVoices;
+
+            voicePhaseOffsets[group].set ((size_t) lane, isActive ? (SampleType) voice / (SampleType) numVoices : (SampleType) 0);
+            voiceGains[group].set ((size_t) lane, isActive ? gain : (SampleType) 0);
+        }
+    }
+
+    for (int voice = 0; voice < maxVoices; ++voice)
+        voicePhases[voice] = (SampleType) voice / (SampleType) numVoices;
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::updateDelayLength() noexcept
+{
+    // Long enough for the longest delay and the taps read behind it, rounded
+    // up to a power of two so that positions wrap with a mask. At rates below
+    // the prepared one only the start of each line is touched, which keeps the
+    // lines small enough to stay in cache.
+    const auto maxDelaySamples = (int) std::ceil (maximumDelayMs * sampleRate / 1000.0);
+    delayBufferSize = juce::nextPowerOfTwo (maxDelaySamples + maxTaps);
+    delayMask = delayBufferSize - 1;
+}
+
+template <typename SampleType>
+void ChorusEngine<SampleType>::updateChannelPhaseOffsets() noexcept
+{
+    // Lanes past the last channel are left at zero; they carry silence
+    for (int group = 0; group < numChannelGroups; ++group)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const auto channel = group * numLanes + lane;
+            const auto offset = channel < numChannels ? channelSpread * (float) channel / (float) numChannels : 0.0f;
+            channelPhaseOffsets[(size_t) group].set ((size_t) lane, (SampleType) offset);
+        }
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void ChorusEngine<SampleType>::process (const juce::dsp::ProcessContextReplacing<SampleType>& context) noexcept
+{
+    if (context.isBypassed)
+        return;
+
+    auto& block = context.getOutputBlock();
+    const auto numSamples = block.getNumSamples();
+
+    for (size_t start = 0; start < numSamples; start += (size_t) maximumBlockSize)
+    {
+        const auto chunk = block.getSubBlock (start, juce::jmin ((size_t) maximumBlockSize, numSamples - start));
+
+        switch (interpolation)
+        {
+            case Interpolation::lagrange3rd:  processChunk<DelayInterpolators::Lagrange3rd<SampleType>> (chunk); break;
+            case Interpolation::thiran:       processChunk<DelayInterpolators::Thiran<SampleType>> (chunk); break;
+            case Interpolation::linear:
+            default:                          processChunk<DelayInterpolators::Linear<SampleType>> (chunk); break;
+        }
+    }
+}
+
+template <typename SampleType>
+template <typename Interpolator>
+void ChorusEngine<SampleType>::processChunk (const juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    if (useChannelGroups)
+        processChannelGroups<Interpolator> (block);
+    else
+        processVoiceGroups<Interpolator> (block);
+}
+
+template <typename SampleType>
+template <typename Interpolator>
+void ChorusEngine<SampleType>::processVoiceGroups (const juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    const auto numBlockChannels = juce::jmin ((int) block.getNumChannels(), numChannels);
+    const auto numSamples       = (int) block.getNumSamples();
+
+    const auto rates        = rate.process (numSamples);
+    const auto depths       = depth.process (numSamples);
+    const auto centreDelays = centreDelay.process (numSamples);
+    const auto feedbacks    = feedback.process (numSamples);
+    const auto mixes        = mix.process (numSamples);
+
+    const auto samplesPerMs   = (SampleType) (sampleRate / 1000.0);
+    const auto depthScale     = (SampleType) maxDepthMs * samplesPerMs;
+    const auto minDelay       = SIMDType::expand ((SampleType) 1);
+    const auto maxDelay       = SIMDType::expand ((SampleType) (delayBufferSize - maxTaps));
+    const auto shouldTrackPeak = trackWetPeak;
+
+    constexpr auto numTaps = Interpolator::numTaps;
+
+    SIMDType taps[numTaps];
+    alignas (sizeof (SIMDType)) SampleType tapValues[numTaps][numLanes];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto centreSamples = SIMDType::expand ((SampleType) centreDelays[i] * samplesPerMs);
+        const auto depthSamples  = SIMDType::expand ((SampleType) depths[i] * depthScale);
+
+        const auto feedbackGain = (SampleType) feedbacks[i];
+        const auto mixGain = (SampleType) mixes[i];
+
+        for (int channel = 0; channel < numBlockChannels; ++channel)
+        {
+            auto* delayData = delayLines.data() + (size_t) channel * (size_t) delayLineStride;
+            auto* samples = block.getChannelPointer ((size_t) channel);
+
+            const auto input = samples[i];
+            delayData[writePosition] = input - feedbackGain * lastWet[(size_t) channel];
+
+            // There are fewer channels than lanes here, so all of them are in the first group
+            const auto channelOffset = SIMDType::expand (channelPhaseOffsets[0].get ((size_t) channel));
+            auto* states = allpassStates.data() + (size_t) channel * maxVoiceGroups;
+            auto wetSum = SIMDType::expand ((SampleType) 0);
+
+            for (int group = 0; group < numVoiceGroups; ++group)
+            {
+                auto delay = centreSamples + depthSamples * lfo.getValues (voicePhaseOffsets[group] + channelOffset);
+                delay = SIMDType::max (minDelay, SIMDType::min (maxDelay, delay));
+
+                const auto wholeDelay = SIMDType::truncate (delay - Interpolator::fractionOffset);
+                const auto coefficient = Interpolator::getCoefficient (delay - wholeDelay);
+
+                for (int lane = 0; lane < numLanes; ++lane)
+                {
+                    const auto readIndex = writePosition - (int) wholeDelay.get ((size_t) lane);
+
+                    for (int tap = 0; tap < numTaps; ++tap)
+                        tapValues[tap][lane] = delayData[(readIndex - tap) & delayMask];
+                }
+
+                for (int tap = 0; tap < numTaps; ++tap)
+                    taps[tap] = SIMDType::fromRawArray (tapValues[tap]);
+
+                wetSum += Interpolator::interpolate (taps, coefficient, states[group]) * voiceGains[group];
+            }
+
+            const auto wet = wetSum.sum();
+            lastWet[(size_t) channel] = wet;
+
+            if (shouldTrackPeak)
+                wetPeak = juce::jmax (wetPeak, std::abs (wet));
+
+            samples[i] = input + mixGain * (wet - input);
+        }
+
+        writePosition = (writePosition + 1) & delayMask;
+
+        lfo.advance (rates[i]);
+    }
+}
+
+template <typename SampleType>
+template <typename Interpolator>
+void ChorusEngine<SampleType>::processChannelGroups (const juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    const auto numBlockChannels = juce::jmin ((int) block.getNumChannels(), numChannels);
+    const auto numSamples       = (int) block.getNumSamples();
+
+    const auto rates        = rate.process (numSamples);
+    const auto depths       = depth.process (numSamples);
+    const auto centreDelays = centreDelay.process (numSamples);
+    const auto feedbacks    = feedback.process (numSamples);
+    const auto mixes        = mix.process (numSamples);
+
+    const auto samplesPerMs   = (SampleType) (sampleRate / 1000.0);
+    const auto depthScale     = (SampleType) maxDepthMs * samplesPerMs;
+    const auto minDelay       = SIMDType::expand ((SampleType) 1);
+    const auto maxDelay       = SIMDType::expand ((SampleType) (delayBufferSize - maxTaps));
+    const auto voiceGain      = (SampleType) 1 / (SampleType) numVoices;
+    const auto shouldTrackPeak = trackWetPeak;
+
+    constexpr auto numTaps = Interpolator::numTaps;
+
+    SIMDType taps[numTaps];
+    alignas (sizeof (SIMDType)) SampleType tapValues[numTaps][numLanes];
+    alignas (sizeof (SIMDType)) SampleType frame[numLanes];
+
+    const auto zero = SIMDType::expand ((SampleType) 0);
+    auto peaks = zero;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto centreSamples = SIMDType::expand ((SampleType) centreDelays[i] * samplesPerMs);
+        const auto depthSamples  = SIMDType::expand ((SampleType) depths[i] * depthScale);
+        const auto feedbackGain  = SIMDType::expand ((SampleType) feedbacks[i]);
+        const auto mixGain       = SIMDType::expand ((SampleType) mixes[i]);
+
+        for (int group = 0; group < numChannelGroups; ++group)
+        {
+            const auto firstChannel = group * numLanes;
+            const auto numGroupChannels = juce::jlimit (0, numLanes, numBlockChannels - firstChannel);
+
+            for (int lane = 0; lane < numLanes; ++lane)
+                frame[lane] = lane < numGroupChannels ? block.getChannelPointer ((size_t) (firstChannel + lane))[i] : (SampleType) 0;
+
+            const auto input = SIMDType::fromRawArray (frame);
+
+            // Each position in the line holds one sample of every channel in the group
+            auto* delayData = interleavedDelay.data() + (size_t) group * (size_t) delayLineStride;
+            auto& groupLastWet = lastWetGroups[(size_t) group];
+            delayData[writePosition] = input - feedbackGain * groupLastWet;
+
+            auto* states = allpassStates.data() + (size_t) group * maxVoices;
+            auto wetSum = SIMDType::expand ((SampleType) 0);
+
+            for (int voice = 0; voice < numVoices; ++voice)
+            {
+                const auto offsets = channelPhaseOffsets[(size_t) group] + SIMDType::expand (voicePhases[voice]);
+
+                auto delay = centreSamples + depthSamples * lfo.getValues (offsets);
+                delay = SIMDType::max (minDelay, SIMDType::min (maxDelay, delay));
+
+                const auto wholeDelay = SIMDType::truncate (delay - Interpolator::fractionOffset);
+                const auto coefficient = Interpolator::getCoefficient (delay - wholeDelay);
+
+                for (int lane = 0; lane < numLanes; ++lane)
+                {
+                    const auto readIndex = writePosition - (int) wholeDelay.get ((size_t) lane);
+
+                    for (int tap = 0; tap < numTaps; ++tap)
+                        tapValues[tap][lane] = delayData[(readIndex - tap) & delayMask].get ((size_t) lane);
+                }
+
+                for (int tap = 0; tap < numTaps; ++tap)
+                    taps[tap] = SIMDType::fromRawArray (tapValues[tap]);
+
+                wetSum += Interpolator::interpolate (taps, coefficient, states[voice]);
+            }
+
+            const auto wet = wetSum * voiceGain;
+            groupLastWet = wet;
+
+            if (shouldTrackPeak)
+                peaks = SIMDType::max (peaks, SIMDType::max (wet, zero - wet));
+
+            (input + mixGain * (wet - input)).copyToRawArray (frame);
+
+            for (int lane = 0; lane < numGroupChannels; ++lane)
+                block.getChannelPointer ((size_t) (firstChannel + lane))[i] = frame[lane];
+        }
+
+        writePosition = (writePosition + 1) & delayMask;
+
+        lfo.advance (rates[i]);
+    }
+
+    // Lanes past the last channel carry silence, so they don't raise the peak
+    if (shouldTrackPeak)
+        for (size_t lane = 0; lane < (size_t) numLanes; ++lane)
+            wetPeak = juce::jmax (wetPeak, peaks.get (lane));
+}
+
+//==============================================================================
+template class ChorusEngine<float>;
+template class ChorusEngine<double>;
@@ -0,0 +1,207 @@
+/*
+  ==============================================================================
+
+    ChorusEngine.h
+
+    A multi-voice chorus in which every voice reads from the same delay line.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ParameterRamp.h"
+#include "ChorusLfo.h"
+#include "DelayInterpolators.h"
+
+//==============================================================================
+/** The limits and options shared by the float and double chorus engines. */
+struct ChorusEngineBase
+{
+    static constexpr int maxChannels = 64;
+    static constexpr int maxVoices = 8;
+    static constexpr float maxCentreDelayMs = 100.0f;
+    static constexpr float maxDepthMs = 20.0f;
+
+    /** The kernels used to read between samples of the delay line. */
+    enum class Interpolation
+    {
+        linear = 0,
+        lagrange3rd,
+        thiran
+    };
+};
+
+//==============================================================================
+/**
+    A chorus with between 1 and maxVoices modulated taps per channel.
+
+    All voices of a channel share one delay line and one ChorusLfo; each voice
+    is offset in phase from the others. The LFO, the fractional delay reads and
+    the voice summation are evaluated across voices in juce::dsp::SIMDRegister
+    lanes, so a voice costs an interpolated read rather than a whole chorus.
+
+    Rate, depth, centre delay, feedback and mix move linearly to new values over
+    the ramp length, and are read per sample from ParameterRamp buffers.
+
+    With fewer channels than SIMD lanes the voices of a channel share a register.
+    Wider layouts are processed in groups of channels instead, one channel per
+    lane, with the delay lines of a group interleaved so that a write or the
+    feedback and mix stages cost one operation for the whole group. Each channel
+    can be offset in LFO phase from the others.
+
+    The engine is instantiated for float and double. In the double version the
+    delay line, the feedback path and the voice sums are all kept in double.
+*/
+template <typename SampleType>
+class ChorusEngine  : public ChorusEngineBase
+{
+public:
+    //==============================================================================
+    ChorusEngine();
+
+    //==============================================================================
+    /** Sets the longest delay, centre delay plus modulation depth, that the
+        delay lines are sized for. This takes effect on the next prepare().
+    */
+    void setMaximumDelay (float newMaximumDelayMs);
+
+    /** Allocates for the given spec, which is the highest sample rate and
+        block size that the engine will be asked to run at.
+    */
+    void prepare (const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    /** Frees everything allocated by prepare(), which must be called again
+        before the next process().
+    */
+    void release();
+
+    /** Changes the processing rate, up to the rate given to prepare(), without
+        allocating. The delay line is not cleared, but it holds audio at the old
+        rate, so it should be reset before processing.
+    */
+    void setSampleRate (double newSampleRate) noexcept;
+    void process (const juce::dsp::ProcessContextReplacing<SampleType>& context) noexcept;
+
+    /** Takes over the delay lines, feedback and LFO phase of another engine that
+        was prepared with the same spec, and jumps straight to the parameter
+        targets, so that this engine can be crossfaded in to replace the other.
+    */
+    void continueFrom (const ChorusEngine& other) noexcept;
+
+    /** Takes over only the LFO phase of another engine, which may be running at
+        a different rate, and jumps straight to the parameter targets. The delay
+        lines are left as they are.
+    */
+    void continueModulationFrom (const ChorusEngine& other) noexcept;
+
+    //==============================================================================
+    /** Sets the LFO rate in Hz. */
+    void setRate (float newRateHz);
+
+    /** Sets the modulation depth, from 0 to 1 of maxDepthMs. */
+    void setDepth (float newDepth);
+
+    /** Sets the delay around which the voices are modulated, in milliseconds. */
+    void setCentreDelay (float newDelayMs);
+
+    /** Sets the feedback of the shared delay line, from -1 to 1. */
+    void setFeedback (float newFeedback);
+
+    /** Sets the wet proportion of the output, from 0 to 1. */
+    void setMix (float newMix);
+
+    /** Sets the shape of the LFO that modulates the delay. */
+    void setLfoShape (ChorusLfo::Shape newShape);
+
+    /** Sets the kernel used for the fractional delay reads. */
+    void setInterpolation (Interpolation newInterpolation);
+
+    /** Accumulates the LFO phase in double precision. */
+    void setHighPrecisionLfo (bool shouldUseHighPrecision);
+
+    /** Spreads the LFO phase of the channels across this fraction of a cycle,
+        from 0, where all channels move together, to 1.
+    */
+    void setChannelSpread (float newSpread);
+
+    /** Sets the number of voices, from 1 to maxVoices. */
+    void setNumVoices (int newNumVoices);
+
+    /** Sets the time over which parameter changes are smoothed. */
+    void setRampLength (double newRampLengthSeconds);
+
+    //==============================================================================
+    /** The delay the first voice of the first channel is reading at, in
+        milliseconds, with the LFO where it is now.
+    */
+    float getModulatedDelayMs() const noexcept;
+
+    /** Turns tracking of the wet peak on or off. It's off by default, so that
+        processing doesn't pay for it unless something reads it.
+    */
+    void setWetPeakTracking (bool shouldTrack) noexcept;
+
+    /** The largest wet sample on any channel since resetWetPeak(), while
+        tracking is on.
+    */
+    SampleType getWetPeak() const noexcept      { return wetPeak; }
+    void resetWetPeak() noexcept                { wetPeak = 0; }
+
+private:
+    //==============================================================================
+    using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+
+    static constexpr int numLanes = (int) SIMDType::SIMDNumElements;
+    static constexpr int maxTaps = 4;    // the most taps any interpolator reads
+    static constexpr int maxVoiceGroups = (maxVoices + numLanes - 1) / numLanes;
+
+    void updateVoiceLayout() noexcept;
+    void updateDelayLength() noexcept;
+    void updateChannelPhaseOffsets() noexcept;
+
+    template <typename Interpolator>
+    void processChunk (const juce::dsp::AudioBlock<SampleType>& block) noexcept;
+
+    template <typename Interpolator>
+    void processVoiceGroups (const juce::dsp::AudioBlock<SampleType>& block) noexcept;
+
+    template <typename Interpolator>
+    void processChannelGroups (const juce::dsp::AudioBlock<SampleType>& block) noexcept;
+
+    //==============================================================================
+    // Used with fewer channels than lanes: one delay line per channel, end to end
+    std::vector<SampleType> delayLines;
+    std::vector<SampleType> lastWet;
+
+    // Used for wider layouts: one interleaved delay line per group of channels
+    std::vector<SIMDType> interleavedDelay, lastWetGroups;
+    bool useChannelGroups = false;
+    int numChannels = 0, numChannelGroups = 0;
+
+    std::vector<SIMDType> allpassStates, channelPhaseOffsets;
+    float maximumDelayMs = maxCentreDelayMs + maxDepthMs;
+    // Each line is allocated delayLineStride samples for the prepared rate, and
+    // only the first delayBufferSize are used at the current rate.
+    int delayLineStride = 0, delayBufferSize = 0, delayMask = 0, writePosition = 0;
+    float channelSpread = 0.0f;
+    SampleType wetPeak = 0;
+    bool trackWetPeak = false;
+
+    SIMDType voicePhaseOffsets[maxVoiceGroups];
+    SIMDType voiceGains[maxVoiceGroups];
+    SampleType voicePhases[maxVoices] {};
+    int numVoices = 1, numVoiceGroups = 1;
+    Interpolation interpolation = Interpolation::linear;
+
+    double sampleRate = 44100.0, preparedSampleRate = 44100.0;
+    int maximumBlockSize = 0;
+
+    ChorusLfo lfo;
+
+    ParameterRamp rate, depth, centreDelay, feedback, mix;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChorusEngine)
+};
@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    ChorusLfo.cpp
+
+  ==============================================================================
+*/
+
+#include "ChorusLfo.h"
+
+namespace
+{
+    constexpr int pointsPerCycle = 1024;
+    constexpr int randomCyclesPerTable = 64;
+    constexpr int randomPointsPerCycle = 64;
+
+    /** A table with one guard point at the end, so reads at index + 1 never wrap. */
+    struct Wavetable
+    {
+        template <typename Function>
+        Wavetable (int numPoints, int numCycles, Function&& function)
+            : values ((size_t) numPoints + 1), cycles (numCycles)
+        {
+            for (int i = 0; i < numPoints; ++i)
+                values[(size_t) i] = function ((double) i / (double) numPoints);
+
+            values.back() = values.front();
+        }
+
+        int getSize() const noexcept    { return (int) values.size() - 1; }
+
+        std::vector<float> values;
+        int cycles;
+    };
+
+    const Wavetable& getWavetable (ChorusLfo::Shape shape)
+    {
+        static const Wavetable sine (pointsPerCycle, 1, [] (double phase)
+        {
+            return (float) std::sin (juce::MathConstants<double>::twoPi * phase);
+        });
+
+        static const Wavetable triangle (pointsPerCycle, 1, [] (double phase)
+        {
+            // Starts at zero and rises, in step with the sine
+            const auto shifted = phase + 0.25 - std::floor (phase + 0.25);
+            return (float) (1.0 - 4.0 * std::abs (shifted - 0.5));
+        });
+
+        static const Wavetable smoothedRandom (randomCyclesPerTable * randomPointsPerCycle, randomCyclesPerTable, [] (double phase)
+        {
+            // A fixed seed keeps renders repeatable; points are joined with a
+            // raised-cosine curve so that the delay time has no corners.
+            static const auto points = []
+            {
+                juce::Random random (0x43686f72);
+                std::array<float, randomCyclesPerTable> values;
+
+                for (auto& value : values)
+                    value = random.nextFloat() * 2.0f - 1.0f;
+
+                return values;
+            }();
+
+            const auto position = phase * randomCyclesPerTable;
+            const auto index = (int) position;
+            const auto fraction = position - (double) index;
+            const auto smoothed = 0.5 - 0.5 * std::cos (juce::MathConstants<double>::pi * fraction);
+
+            const auto a = points[(size_t) index];
+            const auto b = points[(size_t) ((index + 1) % randomCyclesPerTable)];
+            return (float) (a + (b - a) * smoothed);
+        });
+
+        switch (shape)
+        {
+            case ChorusLfo::Shape::triangle:        return triangle;
+            case ChorusLfo::Shape::smoothedRandom:  return smoothedRandom;
+            case ChorusLfo::Shape::sine:
+            default:                                return sine;
+        }
+    }
+}
+
+//==============================================================================
+ChorusLfo::ChorusLfo()
+{
+    // Builds every table up front, so that changing shape never allocates
+    for (auto tableShape : { Shape::triangle, Shape::smoothedRandom, Shape::sine })
+        setShape (tableShape);
+}
+
+void ChorusLfo::prepare (double newSampleRate) noexcept
+{
+    setSampleRate (newSampleRate);
+    reset();
+}
+
+void ChorusLfo::setSampleRate (double newSampleRate) noexcept
+{
+    jassert (newSampleRate > 0);
+
+    sampleRate = newSampleRate;
+    updateIncrement();
+}
+
+void ChorusLfo::reset() noexcept
+{
+    phase = 0.0f;
+    precisePhase = 0.0;
+}
+
+void ChorusLfo::setShape (Shape newShape) noexcept
+{
+    const auto& wavetable = getWavetable (newShape);
+
+    shape = newShape;
+    table = wavetable.values.data();
+    tableSize = wavetable.getSize();
+    tableMask = tableSize - 1;
+    cyclesPerTable = wavetable.cycles;
+
+    updateIncrement();
+}
+
+void ChorusLfo::setHighPrecision (bool shouldUseHighPrecision) noexcept
+{
+    if (shouldUseHighPrecision && ! highPrecision)
+        precisePhase = (double) phase;
+
+    highPrecision = shouldUseHighPrecision;
+}
+
+void ChorusLfo::updateIncrement() noexcept
+{
+    precisePhaseIncrementPerHz = 1.0 / (sampleRate * cyclesPerTable);
+    phaseIncrementPerHz = (float) precisePhaseIncrementPerHz;
+}
@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    ChorusLfo.h
+
+    A wavetable LFO that evaluates several phase-offset voices at once.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    A phase-accumulating wavetable LFO for the chorus voices.
+
+    Each shape is a shared, precomputed table read with linear interpolation, so
+    there are no calls to std::sin on the audio thread. The table for the
+    smoothed random shape spans many cycles, and the voice phase offsets are
+    applied across the whole table so that every voice follows a different
+    random path.
+*/
+class ChorusLfo
+{
+public:
+    //==============================================================================
+    enum class Shape
+    {
+        sine = 0,
+        triangle,
+        smoothedRandom
+    };
+
+    using SIMDFloat = juce::dsp::SIMDRegister<float>;
+
+    //==============================================================================
+    ChorusLfo();
+
+    void prepare (double newSampleRate) noexcept;
+    void reset() noexcept;
+
+    /** Changes the sample rate, keeping the current phase. */
+    void setSampleRate (double newSampleRate) noexcept;
+
+    void setShape (Shape newShape) noexcept;
+    Shape getShape() const noexcept             { return shape; }
+
+    /** Accumulates the phase in double precision, for long offline renders. */
+    void setHighPrecision (bool shouldUseHighPrecision) noexcept;
+
+    /** Moves to the same phase as another LFO, whatever its shape and rate. */
+    void copyPhaseFrom (const ChorusLfo& other) noexcept
+    {
+        phase = other.phase;
+        precisePhase = other.precisePhase;
+    }
+
+    //==============================================================================
+    /** Returns the output, from -1 to 1, for one voice per SIMD lane.
+
+        The offsets are fractions of the table, from 0 to 1. The output can be
+        evaluated in float or double lanes; the tables themselves are float.
+    */
+    template <typename SampleType>
+    juce::dsp::SIMDRegister<SampleType> getValues (juce::dsp::SIMDRegister<SampleType> phaseOffsets) const noexcept
+    {
+        using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+        constexpr auto lanes = SIMDType::SIMDNumElements;
+
+        auto position = SIMDType::expand (highPrecision ? (SampleType) precisePhase : (SampleType) phase) + phaseOffsets;
+        position = (position - SIMDType::truncate (position)) * (SampleType) tableSize;
+
+        const auto whole = SIMDType::truncate (position);
+        const auto fraction = position - whole;
+
+        alignas (sizeof (SIMDType)) SampleType current[lanes];
+        alignas (sizeof (SIMDType)) SampleType next[lanes];
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const auto index = (int) whole.get (lane) & tableMask;
+            current[lane] = (SampleType) table[index];
+            next[lane] = (SampleType) table[index + 1];
+        }
+
+        const auto a = SIMDType::fromRawArray (current);
+        const auto b = SIMDType::fromRawArray (next);
+        return a + (b - a) * fraction;
+    }
+
+    /** Moves the LFO on by one sample at the given rate in Hz. */
+    void advance (float rateHz) noexcept
+    {
+        if (highPrecision)
+        {
+            precisePhase += rateHz * precisePhaseIncrementPerHz;
+
+            if (precisePhase >= 1.0)
+                precisePhase -= 1.0;
+
+            phase = (float) precisePhase;
+            return;
+        }
+
+        phase += rateHz * phaseIncrementPerHz;
+
+        if (phase >= 1.0f)
+            phase -= 1.0f;
+    }
+
+private:
+    //==============================================================================
+    void updateIncrement() noexcept;
+
+    Shape shape = Shape::sine;
+    const float* table = nullptr;
+    int tableSize = 0, tableMask = 0, cyclesPerTable = 1;
+
+    double sampleRate = 44100.0;
+    float phase = 0.0f, phaseIncrementPerHz = 0.0f;
+    double precisePhase = 0.0, precisePhaseIncrementPerHz = 0.0;
+    bool highPrecision = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChorusLfo)
+};
@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    ChorusLookAndFeel.cpp
+
+  ==============================================================================
+*/
+
+#include "ChorusLookAndFeel.h"
+
+namespace
+{
+    /** The geometry LookAndFeel_V4 uses for a rotary slider of this size. */
+    struct RotaryGeometry
+    {
+        RotaryGeometry (float width, float height)
+        {
+            bounds = juce::Rectangle<float> (width, height).reduced (10.0f);
+            const auto radius = juce::jmin (bounds.getWidth(), bounds.getHeight()) / 2.0f;
+            lineWidth = juce::jmin (8.0f, radius * 0.5f);
+            arcRadius = radius - lineWidth * 0.5f;
+        }
+
+        void strokeArc (juce::Graphics& g, float startAngle, float endAngle) const
+        {
+            juce::Path arc;
+            arc.addCentredArc (bounds.getCentreX(), bounds.getCentreY(), arcRadius, arcRadius, 0.0f, startAngle, endAngle, true);
+            g.strokePath (arc, juce::PathStrokeType (lineWidth, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+        }
+
+        juce::Rectangle<float> bounds;
+        float lineWidth, arcRadius;
+    };
+}
+
+//==============================================================================
+ChorusLookAndFeel::ChorusLookAndFeel()
+{
+    setColour (juce::Slider::ColourIds::thumbColourId, juce::Colour::fromRGB (242, 202, 16));
+    setColour (juce::Slider::ColourIds::rotarySliderFillColourId, juce::Colour::fromRGB (115, 155, 184));
+    setColour (juce::Slider::ColourIds::rotarySliderOutlineColourId, juce::Colour::fromRGB (44, 53, 57));
+}
+
+void ChorusLookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
+                                          float rotaryStartAngle, float rotaryEndAngle, juce::Slider& slider)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto& track = getTrackImage (width, height, scale, rotaryStartAngle, rotaryEndAngle,
+                                       slider.findColour (juce::Slider::rotarySliderOutlineColourId));
+
+    g.drawImage (track, juce::Rectangle<int> (x, y, width, height).toFloat());
+
+    const RotaryGeometry geometry ((float) width, (float) height);
+    const auto toAngle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
+
+    juce::Graphics::ScopedSaveState state (g);
+    g.addTransform (juce::AffineTransform::translation ((float) x, (float) y));
+
+    if (slider.isEnabled())
+    {
+        g.setColour (slider.findColour (juce::Slider::rotarySliderFillColourId));
+        geometry.strokeArc (g, rotaryStartAngle, toAngle);
+    }
+
+    const auto thumbWidth = geometry.lineWidth * 2.0f;
+    const auto thumbAngle = toAngle - juce::MathConstants<float>::halfPi;
+    const juce::Point<float> thumbPoint (geometry.bounds.getCentreX() + geometry.arcRadius * std::cos (thumbAngle),
+                                         geometry.bounds.getCentreY() + geometry.arcRadius * std::sin (thumbAngle));
+
+    g.setColour (slider.findColour (juce::Slider::thumbColourId));
+    g.fillEllipse (juce::Rectangle<float> (thumbWidth, thumbWidth).withCentre (thumbPoint));
+}
+
+const juce::Image& ChorusLookAndFeel::getTrackImage (int width, int height, float scale, float startAngle,
+                                                     float endAngle, juce::Colour colour)
+{
+    for (auto& track : cachedTracks)
+        if (track.width == width && track.height == height && track.scale == scale
+             && track.startAngle == startAngle && track.endAngle == endAngle && track.colour == colour)
+            return track.image;
+
+    // Sizes only pile up while a window is being resized, so the whole cache
+    // is simply dropped when it gets too big.
+    if ((int) cachedTracks.size() >= maxCachedTracks)
+        cachedTracks.clear();
+
+    juce::Image image (juce::Image::ARGB, juce::jmax (1, juce::roundToInt ((float) width * scale)),
+                       juce::jmax (1, juce::roundToInt ((float) height * scale)), true);
+
+    {
+        juce::Graphics g (image);
+        g.addTransform (juce::AffineTransform::scale (scale));
+        g.setColour (colour);
+        RotaryGeometry ((float) width, (float) height).strokeArc (g, startAngle, endAngle);
+    }
+
+    cachedTracks.push_back ({ width, height, scale, startAngle, endAngle, colour, image });
+    return cachedTracks.back().image;
+}
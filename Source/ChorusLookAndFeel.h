@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    ChorusLookAndFeel.h
+
+    The editor's colours, and rotary sliders that keep their static track in
+    an image.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Draws rotary sliders as LookAndFeel_V4 does, but renders the background
+    track once for each size, display scale and colour. Then a value change
+    only strokes the value arc and draws the thumb.
+
+    The editor shares one instance between all of its windows through a
+    juce::SharedResourcePointer, so every open editor reuses the same cache.
+    It is only used on the message thread.
+*/
+class ChorusLookAndFeel  : public juce::LookAndFeel_V4
+{
+public:
+    ChorusLookAndFeel();
+
+    void drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
+                           float rotaryStartAngle, float rotaryEndAngle, juce::Slider& slider) override;
+
+private:
+    /** The background track for one size, scale, colour and pair of angles. */
+    struct CachedTrack
+    {
+        int width, height;
+        float scale, startAngle, endAngle;
+        juce::Colour colour;
+        juce::Image image;
+    };
+
+    const juce::Image& getTrackImage (int width, int height, float scale, float startAngle,
+                                      float endAngle, juce::Colour colour);
+
+    static constexpr int maxCachedTracks = 16;
+    std::vector<CachedTrack> cachedTracks;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChorusLookAndFeel)
+};
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    DelayInterpolators.h
+
+    Fractional-delay kernels for the chorus, evaluated across SIMD lanes.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+    Each kernel reads numTaps consecutive samples, starting at the whole part of
+    (delay - fractionOffset) and moving back in time, and combines them using the
+    remaining fraction. The offset keeps the fraction in the range where the
+    kernel is most accurate: [1, 2) for the Lagrange kernel, which centres it
+    between the middle taps, and [0.618, 1.618) for the Thiran allpass, which
+    keeps the allpass coefficient away from the pole at -1.
+
+    Kernels are selected with a template parameter, so the processing loop is
+    compiled once per kernel and sample type, and never branches on the
+    interpolation type.
+*/
+namespace DelayInterpolators
+{
+    //==============================================================================
+    template <typename SampleType>
+    struct Linear
+    {
+        using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+
+        static constexpr int numTaps = 2;
+        static constexpr SampleType fractionOffset = 0;
+
+        static SIMDType getCoefficient (SIMDType fraction) noexcept
+        {
+            return fraction;
+        }
+
+        static SIMDType interpolate (const SIMDType* taps, SIMDType fraction, SIMDType&) noexcept
+        {
+            return taps[0] + (taps[1] - taps[0]) * fraction;
+        }
+    };
+
+    //==============================================================================
+    template <typename SampleType>
+    struct Lagrange3rd
+    {
+        using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+
+        static constexpr int numTaps = 4;
+        static constexpr SampleType fractionOffset = 1;
+
+        static SIMDType getCoefficient (SIMDType fraction) noexcept
+        {
+            return fraction;
+        }
+
+        static SIMDType interpolate (const SIMDType* taps, SIMDType fraction, SIMDType&) noexcept
+        {
+            const auto d1 = fraction - (SampleType) 1;
+            const auto d2 = fraction - (SampleType) 2;
+            const auto d3 = fraction - (SampleType) 3;
+
+            const auto c0 = d1 * d2 * d3 * (SampleType) (-1.0 / 6.0);
+            const auto c1 = d2 * d3 * (SampleType) 0.5;
+            const auto c2 = d1 * d3 * (SampleType) -0.5;
+            const auto c3 = d1 * d2 * (SampleType) (1.0 / 6.0);
+
+            return taps[0] * c0 + fraction * (taps[1] * c1 + taps[2] * c2 + taps[3] * c3);
+        }
+    };
+
+    //==============================================================================
+    /** A first-order Thiran allpass. Its state must be kept per voice and channel. */
+    template <typename SampleType>
+    struct Thiran
+    {
+        using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+
+        static constexpr int numTaps = 2;
+        static constexpr SampleType fractionOffset = (SampleType) 0.618;
+
+        /** Turns the fraction into the allpass coefficient (1 - d) / (1 + d). */
+        static SIMDType getCoefficient (SIMDType fraction) noexcept
+        {
+            auto coefficient = fraction;
+
+            for (size_t lane = 0; lane < SIMDType::SIMDNumElements; ++lane)
+            {
+                const auto d = fraction.get (lane);
+                coefficient.set (lane, ((SampleType) 1 - d) / ((SampleType) 1 + d));
+            }
+
+            return coefficient;
+        }
+
+        static SIMDType interpolate (const SIMDType* taps, SIMDType coefficient, SIMDType& state) noexcept
+        {
+            state = taps[1] + (taps[0] - state) * coefficient;
+            return state;
+        }
+    };
+}
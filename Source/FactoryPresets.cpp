@@ -0,0 +1,19 @@
+/* (Auto-generated binary data file). */
+
+#include "FactoryPresets.h"
+
+static const unsigned char temp1[] = {66,67,98,107,8,0,0,0,72,0,0,0,66,67,115,116,1,0,11,0,56,0,0,0,26,177,158,205,0,0,0,0,0,0,0,0,0,0,128,63,
+  0,0,0,0,0,0,0,0,0,0,128,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,65,77,69,4,0,0,0,73,110,105,116,82,0,0,0,66,67,115,116,1,0,11,0,66,0,
+  0,0,136,192,73,241,0,0,128,63,51,51,179,62,0,0,224,64,0,0,0,0,0,0,0,63,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,78,65,77,69,14,0,0,
+  0,67,108,97,115,115,105,99,32,67,104,111,114,117,115,82,0,0,0,66,67,115,116,1,0,11,0,66,0,0,0,110,158,36,149,0,0,128,63,205,204,204,61,0,0,
+  160,65,0,0,0,0,51,51,179,62,0,0,128,63,0,0,0,64,0,0,128,63,0,0,0,0,0,0,0,0,0,0,0,63,78,65,77,69,14,0,0,0,83,117,98,116,108,101,32,68,111,117,
+  98,108,101,114,81,0,0,0,66,67,115,116,1,0,11,0,65,0,0,0,18,196,114,194,0,0,128,63,0,0,0,63,0,0,64,65,205,204,204,61,154,153,25,63,0,0,192,64,
+  0,0,0,0,0,0,128,63,0,0,0,0,0,0,0,0,0,0,128,63,78,65,77,69,13,0,0,0,87,105,100,101,32,69,110,115,101,109,98,108,101,79,0,0,0,66,67,115,116,1,
+  0,11,0,63,0,0,0,68,204,241,65,0,0,128,63,154,153,25,62,0,0,0,64,51,51,51,63,0,0,0,63,0,0,128,63,0,0,128,63,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+  78,65,77,69,11,0,0,0,74,101,116,32,70,108,97,110,103,101,114,82,0,0,0,66,67,115,116,1,0,11,0,66,0,0,0,92,39,223,54,0,0,128,63,154,153,25,62,
+  0,0,0,64,51,51,51,191,0,0,0,63,0,0,128,63,0,0,128,63,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,78,65,77,69,14,0,0,0,72,111,108,108,111,119,32,70,108,
+  97,110,103,101,114,75,0,0,0,66,67,115,116,1,0,11,0,59,0,0,0,111,79,213,222,0,0,160,64,205,204,76,62,0,0,160,64,0,0,0,0,0,0,128,63,0,0,128,63,
+  0,0,0,0,0,0,128,63,0,0,0,0,0,0,0,0,0,0,0,0,78,65,77,69,7,0,0,0,86,105,98,114,97,116,111,82,0,0,0,66,67,115,116,1,0,11,0,66,0,0,0,37,48,141,
+  114,0,0,0,64,205,204,204,62,0,0,112,65,154,153,153,62,0,0,0,63,0,0,0,65,0,0,0,64,0,0,128,63,0,0,128,63,0,0,0,0,0,0,128,63,78,65,77,69,14,0,
+  0,0,82,97,110,100,111,109,32,83,104,105,109,109,101,114,0,0};
+const char* FactoryPresets::factory_bank = (const char*) temp1;
@@ -0,0 +1,9 @@
+/* (Auto-generated binary data file). */
+
+#pragma once
+
+namespace FactoryPresets
+{
+    extern const char*  factory_bank;
+    const int           factory_bankSize = 675;
+}
@@ -0,0 +1,2413 @@
+/* (Auto-generated pixel data file). */
+
+#include "LogoPixels.h"
+
+static const unsigned int temp1[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5050505,0x21212121,0x22222222,0x22222222,0x22222222,0xe0e0e0e,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x7d7d7d7d,0xe7e7e7e7,0xecececec,
+  0xecececec,0xecececec,0xc3c3c3c3,0x16161616,0,0,0x79797979,0xecececec,0xe5e5e5e5,0xc0c0c0c,0x2a2a2a2a,0xecececec,0xecececec,0x5a5a5a5a,0,0,
+  0xb2b2b2b2,0xecececec,0xecececec,0xecececec,0xecececec,0xdadadada,0x4a4a4a4a,0,0,0x4d4d4d4d,0xecececec,0xecececec,0xecececec,0xecececec,0xecececec,
+  0xecececec,0x32323232,0,0x7070707,0xcacacaca,0xfbfbfbfb,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xebebebeb,0x2b2b2b2b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x12121212,0xfafafafa,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,
+  0xc0c0c0c0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe8e8e8e8,0x8080808,0,0x54545454,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x36363636,0,0x43434343,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x8b8b8b8b,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2d2d2d2d,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x97979797,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,
+  0,0,0xc0c0c0c0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2f2f2f2f,0,0x53535353,0xfefefefe,0xfefefefe,0xffffffff,0xffffffff,
+  0xfefefefe,0xfefefefe,0x35353535,0,0x59595959,0xffffffff,0xffffffff,0xf6f6f6f6,0xf3f3f3f3,0xffffffff,0xffffffff,0xa1a1a1a1,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,
+  0x8a8a8a8a,0x4a4a4a4a,0xf3f3f3f3,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,
+  0,0,0xc0c0c0c0,0xffffffff,0xd5d5d5d5,0x3e3e3e3e,0x86868686,0xffffffff,0xffffffff,0x3b3b3b3b,0,0xc0c0c0c,0x26262626,0x5f5f5f5f,0xffffffff,0xffffffff,
+  0x45454545,0x26262626,0x8080808,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x31313131,0x1010101,0xe9e9e9e9,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,
+  0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,
+  0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,
+  0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,
+  0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,
+  0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,
+  0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,
+  0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,
+  0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,
+  0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,
+  0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,
+  0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,
+  0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,
+  0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010101,0x2020202,0x2020202,0x2020202,0,0x2020202,
+  0,0x1010101,0x1010101,0,0x2020202,0x2020202,0x1010101,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,
+  0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,
+  0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,
+  0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xe0e0e0e0,
+  0xe0e0e0e0,0xe0e0e0e0,0x2c2c2c2c,0xe0e0e0e0,0x39393939,0x87878787,0xadadadad,0x3a3a3a3a,0xe0e0e0e0,0xe0e0e0e0,0xb9b9b9b9,0,0,0x2f2f2f2f,0xffffffff,
+  0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,
+  0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,
+  0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5c5c5c5c,0xe8e8e8e8,0xfefefefe,0xdcdcdcdc,0x2f2f2f2f,0xffffffff,0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,
+  0xffffffff,0xe0e0e0e0,0xb5b5b5b5,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,
+  0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,
+  0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010101,0x5f5f5f5f,0xf8f8f8f8,0xe0e0e0e,0x1f1f1f1f,
+  0xffffffff,0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,0xffffffff,0x25252525,0x1010101,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x88888888,0x53535353,
+  0xedededed,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,
+  0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,
+  0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,0xffffffff,0x24242424,0,
+  0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,
+  0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,
+  0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x190b0f12,0x46202b32,0x5b293742,0x2812181d,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,
+  0x1f1f1f1f,0xffffffff,0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,0xffffffff,0x24242424,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,
+  0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,
+  0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0x2b131a1f,0x72334552,0x71334552,0x71334451,0x70324451,0x6f324350,0x6e324350,0x6d31434f,
+  0x6d31424e,0x6c31424e,0x6b30414d,0x6a30414d,0x6a30404c,0x692f404c,0x682f3f4b,0x672f3f4a,0x662e3e4a,0x662e3e49,0x652e3d49,0x642d3d48,0x632d3c48,
+  0x632c3c47,0x622c3b47,0x612c3b46,0x602b3b46,0x5f2b3a45,0x5f2b3a44,0x5e2a3944,0x5d2a3943,0x5c2a3843,0x5c293842,0x58283640,0x3d1c252c,0xb050608,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0x2410161a,0xae4e6a7e,0xf87097b3,0xff739bb8,0xff739bb8,0x6e324350,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,0xa7a7a7a7,
+  0xd0d0d0d0,0xc5c5c5c5,0x42424242,0xffffffff,0xc1c1c1c1,0x5e5e5e5e,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0xcccccccc,0xb5b5b5b5,0xf7f7f7f7,0xffffffff,
+  0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,
+  0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,
+  0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0x5f2b3a45,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xec6b90aa,0x813a4f5d,0xa050607,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0x3030300,0x100f0c01,0x9080701,0x441f2931,0xef6c91ac,0xff739bb8,0xf36e94af,0xc358768c,0xac4e697c,0x4a212d36,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,
+  0x1f1f1f1f,0xffffffff,0xfefefefe,0xfefefefe,0xc5c5c5c5,0x42424242,0xffffffff,0xfafafafa,0x81818181,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,
+  0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,
+  0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,
+  0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0x38192228,0x95435b6c,0x96445b6c,0x97445c6d,0x97445c6d,0x98455d6e,0x99455d6e,0x9a455d6f,
+  0x9b465e70,0x9b465e70,0x9c465f71,0x9d475f71,0x9e476072,0x9e476072,0x9f486173,0xa0486173,0xa1486274,0xa2496275,0xa2496375,0xa34a6376,0xa44a6476,
+  0xa54a6477,0xa54b6577,0xa64b6578,0xa74b6578,0xa84c6679,0xa84c667a,0xa94c677a,0xaa4d677b,0xab4d687b,0xac4d687c,0xb04f6b7f,0xd05e7e96,0xfd729ab6,
+  0xff739bb8,0xcc5c7c94,0x190b0f12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x10100d01,0x2d2a2303,0x3e3b3104,0x37342c03,0x371b2225,0xf56f95b1,0xf76f96b2,0x7c384b5a,0x1007090b,0,0,0,0,
+  0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,0x5d5d5d5d,0xa9a9a9a9,0xc5c5c5c5,0x42424242,0xffffffff,0x24242424,0,0,0,0x2f2f2f2f,0xffffffff,
+  0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x83838383,0xffffffff,0xf8f8f8f8,0xd0d0d0d,0x2d2d2d2d,0xffffffff,0xffffffff,0x62626262,
+  0,0,0xc0c0c0c0,0xffffffff,0xc8c8c8c8,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,
+  0x5a5a5a5a,0xffffffff,0xffffffff,0x30303030,0,0xe6e6e6e6,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0x2812181d,0xb3516d81,0xff739bb8,0xd35f8098,0x190f110c,0x2d2a2303,0x1c1a1602,0x6060500,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5050400,0x2b282203,0x3f3c3204,0x403d3304,0x403d3304,0x1c161508,
+  0xd962849c,0xf56f95b1,0x47202b34,0x4020203,0x5b293742,0xa74b6578,0xbe567489,0x5325323c,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,
+  0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,0xffffffff,0x24242424,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,
+  0x99999999,0,0,0x83838383,0xffffffff,0xf9f9f9f9,0xf0f0f0f,0x30303030,0xffffffff,0xffffffff,0x62626262,0,0,0xc0c0c0c0,0xffffffff,0xcccccccc,
+  0x11111111,0x66666666,0xffffffff,0xffffffff,0x3b3b3b3b,0,0,0,0x43434343,0xffffffff,0xffffffff,0x25252525,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,
+  0x30303030,0,0xe7e7e7e7,0xffffffff,0xa2a2a2a2,0,0x5024313a,0xd560829a,0xd5608199,0xd4608199,0xd35f8098,0xd25f8098,0xd25f7f97,0xd15e7f97,0xd05e7e96,
+  0xcf5d7e96,0xce5d7d95,0xce5d7d94,0xcd5c7d94,0xcc5c7c93,0xcb5c7c93,0xcb5b7b92,0xca5b7b92,0xc95b7a91,0xc85a7a91,0xc85a7990,0xc75a798f,0xc659788f,
+  0xc559788e,0xc459778e,0xc458778d,0xc358768d,0xc258768c,0xc157768c,0xc157758b,0xc057758a,0xbf56748a,0xbb547287,0x96445b6c,0x35182026,0x3020202,
+  0x8d405666,0xff739bb8,0xa1496274,0x22211b02,0x403d3304,0x3c393004,0x211f1a02,0x2020200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb0a0801,0x38352c03,0x403d3304,0x403d3304,0x39362d04,0x1f1e1902,0x7b384b59,
+  0xff739bb8,0x642d3d48,0x13090c0e,0xc257768c,0xff739bb8,0xff739bb8,0xff739bb8,0x6e324350,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,
+  0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,0xffffffff,0x24242424,0,0,0,0x2f2f2f2f,0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,
+  0x99999999,0,0,0x7e7e7e7e,0xffffffff,0xffffffff,0xf6f6f6f6,0xf8f8f8f8,0xffffffff,0xffffffff,0x5c5c5c5c,0,0,0xc0c0c0c0,0xffffffff,0xffffffff,
+  0xfdfdfdfd,0xfefefefe,0xffffffff,0xffffffff,0x34343434,0,0x50505050,0xf5f5f5f5,0xf7f7f7f7,0xffffffff,0xffffffff,0xf6f6f6f6,0xf5f5f5f5,0x33333333,
+  0,0x5a5a5a5a,0xffffffff,0xffffffff,0xebebebeb,0xe5e5e5e5,0xfefefefe,0xffffffff,0xa2a2a2a2,0,0x5f2b3a45,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xfd729ab6,0x833b505f,0x4020203,0xac4e697c,0xfe739bb8,0x4120292c,0x3b382f04,0x403d3304,0x403d3304,0x35322a03,0x9080701,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xa090801,0x39362d04,0x403d3304,
+  0x3d3a3104,0x1e1d1802,0x3030200,0xb050707,0xe9698da8,0xc157758b,0x6030404,0xbd557389,0xff739bb8,0xf26d93ae,0xa1496274,0x823b4f5e,0x38192228,
+  0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,0xffffffff,0x8c8c8c8c,0x64646464,0,0,0x2f2f2f2f,
+  0xffffffff,0xffffffff,0x4f4f4f4f,0,0xe4e4e4e4,0xffffffff,0x99999999,0,0,0x59595959,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x37373737,0,0,0xc0c0c0c0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3f3f3f3,0xe0e0e0e,0,0x54545454,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x36363636,0,0x4a4a4a4a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x92929292,0,0x2b131a1f,
+  0x73344653,0x74344653,0x74344754,0x75354754,0x75354754,0x76354755,0x76354855,0x77354856,0x77364856,0x78364956,0x78364957,0x79364957,0x79374a57,
+  0x7a374a58,0x7a374a58,0x7b374b59,0x7b384b59,0x7c384b59,0x7c384c5a,0x7d384c5a,0x7d394c5a,0x7e394c5b,0x7e394d5b,0x7f394d5c,0x7f394d5c,0x803a4e5c,
+  0x803a4e5d,0x813a4e5d,0x813a4f5d,0x823b4f5e,0x873d5262,0xb8537085,0xfd729ab6,0xff739bb8,0x77364856,0x190b0f12,0xee6b91ac,0xb5526e82,0x9090701,
+  0x26241e02,0x3f3c3204,0x403d3304,0x3a372e04,0xb0a0901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0x4040300,0x36332b03,0x403d3304,0x39362d04,0xe0d0b01,0x1b1a1502,0x56524405,0x5c2b3940,0xff739bb8,0x441e2931,0x6a30404c,
+  0xff739bb8,0xd35f8098,0x200f1417,0,0,0,0,0x5e5e5e5e,0xf8f8f8f8,0xd0d0d0d,0x1f1f1f1f,0xffffffff,0x41414141,0x9a9a9a9a,0xc5c5c5c5,0x42424242,
+  0xffffffff,0xffffffff,0xd3d3d3d3,0,0,0x2e2e2e2e,0xfbfbfbfb,0xfbfbfbfb,0x4e4e4e4e,0,0xe1e1e1e1,0xfbfbfbfb,0x97979797,0,0,0xa0a0a0a,0xc5c5c5c5,
+  0xfafafafa,0xfbfbfbfb,0xfbfbfbfb,0xf9f9f9f9,0xacacacac,0x1010101,0,0,0xbdbdbdbd,0xfbfbfbfb,0xfbfbfbfb,0xfbfbfbfb,0xfbfbfbfb,0xf6f6f6f6,0x6e6e6e6e,
+  0,0,0x52525252,0xfbfbfbfb,0xfbfbfbfb,0xfbfbfbfb,0xfbfbfbfb,0xfbfbfbfb,0xfbfbfbfb,0x35353535,0,0xe0e0e0e,0xe1e1e1e1,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xf9f9f9f9,0x3d3d3d3d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1000001,0x441f2931,0xef6c91ac,0xf87097b3,
+  0x2a13191e,0x873d5261,0xfa7198b4,0x21121514,0xc0b0a01,0xf0e0c01,0x39362d04,0x403d3304,0x39362d04,0x7060500,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x28261f02,0x403d3304,0x3a372e04,0xa0a0801,0x35332a03,0x7c766308,
+  0x56524405,0xa84c6679,0xdc63859e,0x7030405,0xe16689a2,0xf26d93af,0x23101519,0,0,0,0,0,0x1a1a1a1a,0x44444444,0x3030303,0x8080808,0x46464646,
+  0x12121212,0x2a2a2a2a,0x36363636,0x12121212,0x46464646,0x46464646,0x39393939,0,0,0x6060606,0x20202020,0x20202020,0xa0a0a0a,0,0x1c1c1c1c,0x20202020,
+  0x13131313,0,0,0,0x2020202,0x1d1d1d1d,0x20202020,0x20202020,0x1a1a1a1a,0x1010101,0,0,0,0x18181818,0x20202020,0x20202020,0x20202020,0x20202020,
+  0x13131313,0,0,0,0xa0a0a0a,0x20202020,0x20202020,0x20202020,0x20202020,0x20202020,0x20202020,0x7070707,0,0,0x15151515,0x44444444,0x46464646,
+  0x46464646,0x46464646,0x27272727,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5426333d,0xfe729ab7,0xa0486274,0x2410161a,
+  0xfe739bb7,0x662f3e48,0x6e685707,0x2d2a2303,0x8070600,0x37342b03,0x403d3304,0x302e2603,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x100f0c01,0x3f3c3204,0x3e3b3104,0xf0e0c01,0x3a372e04,0x7f796508,0x80796508,
+  0x3a372e04,0xe4678aa4,0x9342596a,0x421e282f,0xff739bb8,0x863c5261,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1000101,0xc358778d,
+  0xf06c92ae,0xb050708,0xd661829b,0xa0486173,0x5e594a06,0x7f786508,0x3c392f04,0x9090701,0x3b382f04,0x403d3304,0x1b1a1602,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x312f2703,0x403d3304,0x1f1e1902,0x29272103,0x7f786408,
+  0x80796508,0x504c3f05,0x1d101312,0xfc7299b6,0x5d2a3843,0x843c505f,0xfd729ab7,0x2711171c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0x682f3f4b,0xff739bb8,0x3d1b252c,0xa0486174,0xca5b7b92,0x3c382f04,0x80796508,0x80796508,0x322f2803,0x13120f01,0x403c3204,0x3c393004,
+  0x5040400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x100f0c01,0x403d3304,0x37352c03,
+  0xb0b0901,0x746e5c07,0x80796508,0x4a463b05,0xa0a0801,0x3b202623,0xff739bb8,0x37192228,0xaf4f6a7e,0xe6688ca6,0x2010102,0,0x2020202,0x2020202,
+  0x2020202,0x2020202,0x2020202,0x1010101,0,0,0,0,0x2020202,0x2020202,0x2020202,0x2020202,0x2020202,0,0,0,0,0,0x6050500,0x302d2603,0x33312903,
+  0x1c1a1602,0,0x22211b02,0x33312903,0x2c2a2303,0x3020200,0,0,0,0,0x1e1e1e1e,0x33333333,0x33333333,0x33333333,0x33333333,0x21212121,0,0,0x1010101,
+  0x2020202,0x2020202,0x2020202,0x2020202,0x2020202,0,0,0,0,0,0x1010101,0x2020202,0x2020202,0x2020202,0x1010101,0,0,0,0,0x2020202,0x2020202,0,
+  0,0,0,0x2020202,0x2020202,0x1010101,0,0,0x1010101,0x2020202,0x2020202,0,0,0,0,0x2020202,0x2020202,0x1010101,0,0,0x1010101,0x2020202,0x2020202,
+  0x2020202,0x2020202,0x2020202,0,0,0x1010101,0x2020202,0x2020202,0x2020202,0x2020202,0x2020202,0,0,0,0x30161d23,0xff739bb8,0x662e3e49,0x7f394d5b,
+  0xe6688ca6,0x3020201,0x3e3b3104,0x80796508,0x7b756208,0x16151201,0x2a282103,0x403d3304,0x201e1902,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2a282103,0x403d3304,0x17161201,0x4b473b05,0x80796508,0x5c584906,0xd0c0a01,0xbfb5970c,
+  0x603a4032,0xff739bb8,0x2511171b,0xc458778d,0xcb5c7b92,0,0,0xb4b4b4b4,0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0xf3f3f3f3,0x78787878,0,0,
+  0x1d1d1d1d,0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0xd8d8d8d8,0x26262626,0,0,0x1010100,0xbcb3950c,0xfff2ca10,0xfff2ca10,0xa0987f0a,
+  0,0xc1b7990c,0xfff2ca10,0xfff2ca10,0x9d957c0a,0,0,0,0x6a6a6a6a,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa6a6a6a6,0,0,0x67676767,
+  0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0xfbfbfbfb,0xb0b0b0b0,0x7070707,0,0,0x48484848,0xefefefef,0xfefefefe,0xfefefefe,0xfefefefe,0xf2f2f2f2,
+  0x56565656,0,0,0x1b1b1b1b,0xfefefefe,0xfefefefe,0x38383838,0,0,0,0xd2d2d2d2,0xfefefefe,0x95959595,0,0,0x50505050,0xfefefefe,0xf6f6f6f6,0xb0b0b0b,
+  0,0,0xb0b0b0b,0xfbfbfbfb,0xfefefefe,0x61616161,0,0,0x84848484,0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0x13131313,0,0x79797979,
+  0xfefefefe,0xfefefefe,0xfefefefe,0xfefefefe,0xfafafafa,0xa3a3a3a3,0x3030303,0,0x15090d0f,0xff739bb8,0x79374957,0x6e32434f,0xf26d93ae,0x38332c06,
+  0xf0e0c01,0x4a463b05,0x80796508,0x635e4e06,0x9090701,0x3e3b3104,0x3b382e04,0x2020200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3030300,0x3d3a3004,0x3a372e04,0xe0d0b01,0x7b756208,0x7a746108,0x11110e01,0x9e967d0a,0xfef1c910,
+  0x623a4034,0xff739bb8,0x200e1317,0xca5b7a91,0xc358768c,0,0,0xb5b5b5b5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf8f8f8f8,0x16161616,
+  0,0x1e1e1e1e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9c9c9c9c,0,0,0x24231d02,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xa199800a,
+  0,0xc2b89a0c,0xfff2ca10,0xfff2ca10,0xfaeec610,0x8080600,0,0x1010101,0xdbdbdbdb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa6a6a6a6,
+  0,0,0x68686868,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0xbebebebe,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xcfcfcfcf,0,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x6c6c6c6c,0,0,0xc0c0c0c,0xf8f8f8f8,0xffffffff,0x96969696,0,0,0x50505050,
+  0xffffffff,0xffffffff,0x38383838,0,0,0x39393939,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x13131313,0,0x7a7a7a7a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x40404040,0,0xe06080a,0xff739bb8,0x7f394d5c,
+  0x6a30404c,0xf66f96b2,0x6a62530a,0xbab0930c,0x9090701,0x6d675607,0x80796508,0x27251f02,0x29272003,0x403d3304,0x15141001,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x14131001,0x403d3304,0x22211b02,0x3d3a3004,0x80796508,0x46423704,
+  0x44413604,0xfef1c910,0xf6e9c30f,0x59323a34,0xff739bb8,0x200e1317,0xca5b7a91,0xc358768c,0,0,0xb5b5b5b5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x3a3a3a3a,0,0x1e1e1e1e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc6c6c6c6,0,0,0x38352c03,0xfff2ca10,
+  0xfff2ca10,0xe9ddb80f,0x8c856f09,0,0xaaa1860b,0xece0bb0f,0xfff2ca10,0xfef1ca10,0x17161201,0,0x8080808,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xa6a6a6a6,0,0,0x68686868,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x7c7c7c7c,0,0,0xdadadada,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0x2020202,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xa1a1a1a1,0,0,0x37373737,0xffffffff,
+  0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xffffffff,0x6c6c6c6c,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x13131313,0,0x7a7a7a7a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6a6a6a6a,
+  0,0xe06080a,0xff739bb8,0x7f394d5c,0x6a30404c,0xf66f96b2,0x6a62530a,0xfff2ca10,0x77715e07,0x29272103,0x80796508,0x605b4c06,0xf0e0c01,0x403d3304,
+  0x2a282203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x25231d02,0x403d3304,0xf0e0c01,
+  0x67625206,0x7d776308,0x11100d01,0xc3b99b0c,0xfff2ca10,0x6c675607,0x5426333c,0xff739bb8,0x200e1317,0xca5b7a91,0xc358768c,0,0,0xb5b5b5b5,0xffffffff,
+  0xe0e0e0e0,0x2a2a2a2a,0x6f6f6f6f,0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x84848484,0x2a2a2a2a,0xbcbcbcbc,0xffffffff,
+  0xcdcdcdcd,0,0,0x38352c04,0xfff2ca10,0xfdf0c910,0x3030300,0,0,0,0x23211c02,0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,
+  0xa9a9a9a9,0x3a3a3a3a,0x3a3a3a3a,0x3a3a3a3a,0x26262626,0,0,0x68686868,0xffffffff,0xffffffff,0x46464646,0x2f2f2f2f,0xf4f4f4f4,0xffffffff,0x83838383,
+  0,0,0xdbdbdbdb,0xffffffff,0xbfbfbfbf,0x32323232,0xb1b1b1b1,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xd5d5d5d5,0,
+  0,0x68686868,0xffffffff,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xffffffff,0xa0a0a0a0,0,0,0x9d9d9d9d,0xffffffff,0xffffffff,0x61616161,
+  0,0,0x85858585,0xffffffff,0xf9f9f9f9,0x34343434,0x2a2a2a2a,0x2a2a2a2a,0x3030303,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x37373737,0x36363636,0xfdfdfdfd,
+  0xffffffff,0x71717171,0,0xe06080a,0xff739bb8,0x7f394d5c,0x6a30404c,0xfa7198b4,0x493e370e,0xfcefc810,0xefe3bd0f,0x16151201,0x6b665507,0x7e786408,
+  0x13120f01,0x3a372e04,0x3b382f04,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0x32302803,0x3c393004,0xf0e0c01,0x7f786408,0x5f5b4c06,0x2c2a2303,0xfef1c910,0xcec3a30d,0x5040301,0xc258768c,0xec6b90ab,0xd060809,0xcd5c7c94,
+  0xc358768c,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,
+  0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0,0x38352c04,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,
+  0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0,0,0,0,0,0x68686868,0xffffffff,0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,
+  0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xf9f9f9f9,0x10101010,0,0x9a9a9a9a,0xffffffff,
+  0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xffffffff,0xd4d4d4d4,0,0,0xcececece,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,
+  0xf8f8f8f8,0xc0c0c0c,0,0,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,0,0xe06080a,0xff739bb8,
+  0x833b4f5e,0x451f2a32,0xff739bb8,0x7a374a58,0x9c947c0a,0xfff2ca10,0x756f5d07,0x3d3a3004,0x80796508,0x38352c04,0x28262003,0x403d3304,0xc0c0a01,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2010100,0x3d393004,0x302e2603,0x28262003,0x80796508,
+  0x3b382f04,0x7f786508,0xfff2ca10,0x615c4d06,0x3a1a232a,0xff739bb8,0x76354855,0x2e151c22,0xfb7198b5,0xaf4f6b7f,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,
+  0,0x4e4e4e4e,0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0,0x38352c04,
+  0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0,0,0,0,0,
+  0x68686868,0xffffffff,0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,
+  0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xffffffff,0x3f3f3f3f,0,0xcbcbcbcb,0xffffffff,0xffffffff,0x96969696,0,0,0x50505050,
+  0xffffffff,0xffffffff,0xf9f9f9f9,0x10101010,0xb0b0b0b,0xf5f5f5f5,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,
+  0,0,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,0,0x6030304,0xf46e94b0,0xd962849d,0x7030405,
+  0xbf56748a,0xeb6a8fa9,0x2e26230a,0xfbeec710,0xcfc5a40d,0x15141101,0x80796508,0x59544606,0x1a181402,0x403d3304,0x18171302,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x7070600,0x403d3304,0x25231d02,0x403d3304,0x80796508,0x211f1a02,
+  0xbeb4970c,0xf9edc610,0x15141001,0x9f486072,0xee6b91ac,0xe06090a,0xb04f6b7f,0xff739bb8,0x451f2a32,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0x4e4e4e4e,
+  0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0,0x38352c04,0xfff2ca10,
+  0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0,0,0,0,0,0x68686868,
+  0xffffffff,0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,
+  0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xffffffff,0x72727272,0x8080808,0xf4f4f4f4,0xffffffff,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,
+  0xffffffff,0xffffffff,0x3e3e3e3e,0x32323232,0xffffffff,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,
+  0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,0,0,0x90415768,0xff739bb8,0x662e3e49,0x46202b33,
+  0xff739bb8,0x5627343e,0xc1b7990c,0xfbeec710,0x18161301,0x746e5c07,0x706b5907,0xf0e0c01,0x403d3304,0x23211c02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xe0d0b01,0x403d3304,0x1e1d1802,0x504c3f05,0x80796508,0xf0e0c01,0xeadeb90f,
+  0xd2c7a60d,0x1000101,0xe5678ba5,0x9a465e6f,0x34171f25,0xfe739bb7,0xbb557287,0,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0x4e4e4e4e,0xffffffff,
+  0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0,0x38362d04,0xfff2ca10,0xfdf0c810,
+  0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfef1ca10,0x18171302,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0,0,0,0,0,0x68686868,0xffffffff,
+  0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,
+  0,0x1c1c1c1c,0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0x30303030,0xffffffff,0xffffffff,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xffffffff,
+  0xffffffff,0x73737373,0x64646464,0xffffffff,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,0,0,0x7a7a7a7a,
+  0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,0,0,0x160a0e10,0xef6c92ad,0xdc63869f,0x7030505,0xe26689a3,0x9a455e6f,
+  0x7b746108,0xfff2ca10,0x49463a05,0x5d594a06,0x80796508,0xb0b0901,0x403d3304,0x2b292203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x13120f01,0x403d3304,0x19171402,0x5c574906,0x7e786408,0x12110e01,0xfcefc710,0xaca3880b,0x170a0e10,
+  0xfd729ab6,0x5d2a3943,0x8a3e5464,0xff739bb8,0x3e1c262d,0,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0x4e4e4e4e,0xffffffff,0xffffffff,0x41414141,
+  0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0,0x4e4a3d05,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,
+  0xfff2ca10,0xfff2ca10,0x2c2a2303,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0x35353535,0x6b6b6b6b,0x6b6b6b6b,0x6b6b6b6b,0x28282828,0,0x68686868,
+  0xffffffff,0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,
+  0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xffffffff,0xdadadada,0x62626262,0xffffffff,0xffffffff,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,
+  0xffffffff,0xffffffff,0xa7a7a7a7,0x95959595,0xffffffff,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,
+  0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,0,0,0,0x883d5362,0xff739bb8,0x35182026,0xa74b6578,
+  0xc85a7a91,0x4c483c05,0xfff2ca10,0x6c665507,0x4c483c05,0x80796508,0x13120f01,0x3e3b3104,0x302e2603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x15141101,0x403d3304,0x17161201,0x605b4c06,0x7a736008,0x1d1b1702,0xfff2ca10,0x9991790a,
+  0x2b141a1f,0xff739bb8,0x3e1c262d,0xaf4f6a7e,0xea6a8ea9,0x3010202,0,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0x4e4e4e4e,0xffffffff,0xffffffff,
+  0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0,0x9e967d0a,0xfff2ca10,0xfdf0c810,0x1010100,
+  0,0,0,0x201f1902,0xfff2ca10,0xfff2ca10,0x7d766308,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0x7e7e7e7e,0xffffffff,0xffffffff,0xffffffff,
+  0x5f5f5f5f,0,0x68686868,0xffffffff,0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,
+  0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xe1e1e1e1,0xfdfdfdfd,0xa5a5a5a5,0xfdfdfdfd,0xe3e3e3e3,0xffffffff,
+  0x96969696,0,0,0x50505050,0xffffffff,0xf7f7f7f7,0xe9e9e9e9,0xdbdbdbdb,0xc7c7c7c7,0xe1e1e1e1,0xffffffff,0xffffffff,0x61616161,0,0,0x85858585,
+  0xffffffff,0xfcfcfcfc,0xa7a7a7a7,0xa3a3a3a3,0x53535353,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,
+  0,0,0,0x391a2329,0xff739bb8,0x602b3b46,0x863d5261,0xe2668aa3,0x312e2604,0xfff2ca10,0x807a6608,0x433f3504,0x80796508,0x1a191502,0x3b382f04,0x33312903,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x15141101,0x403d3304,0x17161201,0x625d4d06,0x7a746108,
+  0x1b1a1602,0xfff2ca10,0x9991790a,0x33171f25,0xff739bb8,0x35182026,0xb5526e83,0xde6487a0,0,0,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0x4e4e4e4e,
+  0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0,0xaaaaaaaa,0xffffffff,0xcdcdcdcd,0,0x6060500,0xf1e5bf0f,0xfff2ca10,
+  0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfff2ca10,0xd6cbaa0d,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0x7e7e7e7e,0xffffffff,0xffffffff,
+  0xffffffff,0x5f5f5f5f,0,0x68686868,0xffffffff,0xffffffff,0x22222222,0x5050505,0xf0f0f0f0,0xffffffff,0x83838383,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,
+  0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0xa9a9a9a9,0xffffffff,0xf6f6f6f6,0xdbdbdbdb,0xcccccccc,0xffffffff,
+  0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0xb4b4b4b4,0xfefefefe,0xf8f8f8f8,0xa8a8a8a8,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xa0a0a0a,0xfcfcfcfc,0xffffffff,0x71717171,
+  0,0,0,0x2a131a1e,0xff739bb8,0x6a30404c,0x7d384c5a,0xe7688ca7,0x2a272104,0xfff2ca10,0x87806b08,0x3e3b3104,0x80796508,0x1a181402,0x3b382f04,0x34312903,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x13120f01,0x403d3304,0x1a191502,0x5a564806,0x7f786408,
+  0x14131001,0xfbeec710,0xada4890b,0x23101519,0xff739bb8,0x48212c34,0x9c465f71,0xf76f96b2,0x13090b0e,0,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,
+  0x4e4e4e4e,0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0xa0a0a0a0,0x5a5a5a5a,0xcccccccc,0xffffffff,0xcdcdcdcd,0,0x1010100,
+  0xd1c6a50d,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfff2ca10,0xb1a88c0b,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0x56565656,
+  0xe2e2e2e2,0xffffffff,0xe1e1e1e1,0x40404040,0,0x68686868,0xffffffff,0xffffffff,0x70707070,0x5f5f5f5f,0xf7f7f7f7,0xffffffff,0x83838383,0,0,0xdbdbdbdb,
+  0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x71717171,0xffffffff,0xffffffff,0xa3a3a3a3,
+  0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0x7c7c7c7c,0xffffffff,0xffffffff,0x6f6f6f6f,0xfefefefe,0xffffffff,0x61616161,
+  0,0,0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x64646464,0x64646464,0xfdfdfdfd,
+  0xffffffff,0x71717171,0,0,0,0x5527343e,0xff739bb8,0x5124313a,0x9342596a,0xda62859e,0x33312903,0xfff2ca10,0x7d766308,0x43403504,0x80796508,0x17161201,
+  0x3c392f04,0x32302803,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf0e0c01,0x403d3304,0x1f1e1902,
+  0x514d4005,0x80796508,0x12110e01,0xe9ddb80f,0xd9ceac0e,0x8040506,0xf66f95b1,0x78364956,0x5e2a3943,0xff739bb8,0x75354754,0,0,0,0xb5b5b5b5,0xffffffff,
+  0xdfdfdfdf,0x25252525,0x6b6b6b6b,0xffffffff,0xffffffff,0x41414141,0,0x1e1e1e1e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc0c0c0c0,0,0,0x6b665507,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfff2ca10,0x4a463b05,0,0x9090909,0xf6f6f6f6,0xffffffff,
+  0x8a8a8a8a,0,0xa3a3a3a3,0xffffffff,0xa0a0a0a0,0,0,0x68686868,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x76767676,0,
+  0,0xdbdbdbdb,0xffffffff,0xc8c8c8c8,0x67676767,0xbdbdbdbd,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x3d3d3d3d,0xfafafafa,
+  0xffffffff,0x69696969,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0x43434343,0xffffffff,0xffffffff,0x36363636,0xfefefefe,
+  0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xfbfbfbfb,0x75757575,0x6e6e6e6e,0x38383838,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x64646464,0,0,0x1010101,0xbe567389,0xf97097b4,0x190b0f12,0xc057758b,0xb2506c80,0x534f4205,0xfff2ca10,0x67625206,
+  0x4d493d05,0x80796508,0xe0d0b01,0x3f3c3204,0x2f2c2503,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0x8080601,0x403d3304,0x28262003,0x3e3b3104,0x80796508,0x25231d02,0xbab1940c,0xfbeec710,0x1c1a1602,0xc95b7a91,0xc157758b,0xd060809,0xea6a8ea9,
+  0xeb6a8faa,0xf07090b,0,0,0xb5b5b5b5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x38383838,0,0x1e1e1e1e,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x81818181,0,0,0x3e3b3104,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfff2ca10,
+  0x1e1c1702,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0xa3a3a3a3,0xffffffff,0xa0a0a0a0,0,0,0x68686868,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xfdfdfdfd,0x38383838,0,0,0xdbdbdbdb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,
+  0xffffffff,0xffffffff,0x2a2a2a2a,0xd6d6d6d6,0xffffffff,0x31313131,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0x11111111,
+  0xf9f9f9f9,0xf2f2f2f2,0xa0a0a0a,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,0,0,0x7a7a7a7a,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfbfbfbfb,0x28282828,0,0,0x47202b33,0xfe739ab7,0xac4d687c,0x14090c0e,0xf87097b3,0x7c384b5a,0x88816c09,
+  0xfff2ca10,0x3d3a3104,0x605b4c06,0x7b756108,0xa0a0801,0x403d3304,0x28262003,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020100,0x3d3a3004,0x32302803,0x28262003,0x80796508,0x403d3304,0x76705e07,0xfff2ca10,0x736d5b07,0x77364856,
+  0xfd729ab7,0x33171f25,0x71334552,0xff739bb8,0x813a4e5d,0,0,0xb5b5b5b5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x13131313,
+  0,0x1e1e1e1e,0xffffffff,0xffffffff,0xd0d0d0d0,0xe7e7e7e7,0xffffffff,0xd2d2d2d2,0xa0a0a0a,0,0,0x38352c04,0xfff2ca10,0xfdf0c810,0x1010100,0,0,
+  0,0x201f1902,0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0xa3a3a3a3,0xffffffff,0xa0a0a0a0,0,0,0x68686868,
+  0xffffffff,0xffffffff,0xbabababa,0xfdfdfdfd,0xffffffff,0x92929292,0,0,0,0xdbdbdbdb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xeaeaeaea,
+  0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x29292929,0x9d9d9d9d,0xf0f0f0f0,0x6060606,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,
+  0xf4f4f4f4,0,0xd2d2d2d2,0xc1c1c1c1,0x1010101,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,0,0,0x7a7a7a7a,
+  0xffffffff,0xffffffff,0xb9b9b9b9,0xfefefefe,0xffffffff,0x80808080,0,0,0x1000000,0xca5b7b92,0xfb7199b5,0x2b131a1f,0x7c384b59,0xfc7299b6,0x2b141a1e,
+  0xd6cba90d,0xf6eac30f,0x11100e01,0x79736008,0x66615106,0x12110f01,0x403d3304,0x201e1902,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x34312903,0x3e3b3104,0xe0d0b01,0x7d776308,0x65605006,0x23221c02,0xfdf0c810,0xe1d5b20e,0x20131511,
+  0xf36d93af,0xb5526e83,0xa050607,0xe5678ba5,0xc056758a,0,0,0xb5b5b5b5,0xffffffff,0xfcfcfcfc,0xe8e8e8e8,0xe8e8e8e8,0xdededede,0x68686868,0,0,
+  0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0x9b9b9b9b,0xffffffff,0xd3d3d3d3,0,0,0,0x38352c04,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,
+  0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0xa3a3a3a3,0xffffffff,0xa0a0a0a0,0,0,0x68686868,0xffffffff,
+  0xffffffff,0x23232323,0xe4e4e4e4,0xffffffff,0x8a8a8a8a,0,0,0,0xdbdbdbdb,0xffffffff,0xdddddddd,0xa1a1a1a1,0xd6d6d6d6,0xffffffff,0xeaeaeaea,0x3030303,
+  0,0x1c1c1c1c,0xffffffff,0xffffffff,0x29292929,0x65656565,0xbdbdbdbd,0,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,
+  0,0x9a9a9a9a,0x89898989,0x1010101,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,0,0,0x7a7a7a7a,0xffffffff,
+  0xffffffff,0x16161616,0xf0f0f0f0,0xffffffff,0x78787878,0,0,0xc050708,0xfe739bb8,0xa54a6477,0x13090c0e,0xec6b90ab,0xbb547287,0x403d3304,0xfef1c910,
+  0xb9af920c,0x1d1b1702,0x80796508,0x4b483c05,0x1f1d1802,0x403d3304,0x15141101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x25231d02,0x403d3304,0x11100e01,0x65605006,0x7e786408,0x15141001,0xb3aa8e0b,0xfff2ca10,0x89826d09,0x863c5160,
+  0xfe729ab7,0x1b0c1114,0xca5b7a91,0xc358768c,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0x4040404,0x4040404,0x2020202,0,0,0,0x1e1e1e1e,0xffffffff,
+  0xffffffff,0x6c6c6c6c,0x76767676,0xffffffff,0xf4f4f4f4,0x7070707,0,0,0x38352c04,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,
+  0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,0x8a8a8a8a,0,0xa3a3a3a3,0xffffffff,0xa0a0a0a0,0,0,0x68686868,0xffffffff,0xffffffff,
+  0x22222222,0xc0c0c0c0,0xffffffff,0xb1b1b1b1,0,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,
+  0xffffffff,0xffffffff,0x29292929,0x6060606,0xe0e0e0e,0,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0,0xb0b0b0b,0x9090909,
+  0x1010101,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,0,0,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,
+  0xd2d2d2d2,0xffffffff,0x9f9f9f9f,0,0,0xe06080a,0xff739bb8,0x7f394d5c,0x642d3d48,0xfe739bb8,0x401f282c,0xc6bc9d0c,0xfff2ca10,0x58534606,0x48453905,
+  0x80796508,0x29272003,0x2e2c2503,0x403d3304,0x8070600,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0x14131001,0x403d3304,0x26241e02,0x38352c03,0x80796508,0x4b473b05,0x322f2703,0xfaedc610,0xfbefc710,0x5d353d34,0xff739bb8,0x200e1317,
+  0xca5b7a91,0xc358768c,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0,0,0,0,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0x51515151,0xffffffff,0xfefefefe,
+  0x23232323,0,0,0x38352c04,0xfff2ca10,0xfdf0c810,0x1010100,0,0,0,0x201f1902,0xfff2ca10,0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,
+  0x8a8a8a8a,0,0xa3a3a3a3,0xffffffff,0xa0a0a0a0,0,0,0x68686868,0xffffffff,0xffffffff,0x22222222,0x9b9b9b9b,0xffffffff,0xd7d7d7d7,0,0,0,0xdbdbdbdb,
+  0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x29292929,0,0,0,0xcbcbcbcb,0xffffffff,
+  0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0,0,0,0x1010101,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xf8f8f8f8,0xc0c0c0c,
+  0,0,0,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0xadadadad,0xffffffff,0xc5c5c5c5,0,0,0xe06080a,0xff739bb8,0x7f394d5c,0x6a30404c,0xf66f96b2,
+  0x5a534709,0xfff2ca10,0xd6cbaa0d,0xd0c0a01,0x77715e07,0x79736008,0xa090801,0x3e3b3104,0x37342c03,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3030300,0x3c393004,0x3b382e04,0xc0b0901,0x79736008,0x7d766308,0x14131001,0x837c6808,
+  0xfef1c910,0x623a4034,0xff739bb8,0x200e1317,0xca5b7a91,0xc358768c,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0,0,0,0,0,0x1e1e1e1e,0xffffffff,0xffffffff,
+  0x6c6c6c6c,0x2d2d2d2d,0xffffffff,0xffffffff,0x49494949,0,0,0x38352c04,0xfff2ca10,0xfdf1c910,0xa090801,0x3030300,0,0x4040300,0x28262003,0xfff2ca10,
+  0xfef1ca10,0x17161301,0,0x9090909,0xf6f6f6f6,0xffffffff,0xa6a6a6a6,0x34343434,0xbabababa,0xffffffff,0xa0a0a0a0,0,0,0x68686868,0xffffffff,0xffffffff,
+  0x22222222,0x77777777,0xffffffff,0xf5f5f5f5,0x9090909,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,
+  0xffffffff,0xffffffff,0x29292929,0,0,0,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0,0,0,0x1010101,0xfefefefe,0xffffffff,
+  0x61616161,0,0,0x85858585,0xffffffff,0xf9f9f9f9,0x2e2e2e2e,0x24242424,0x24242424,0x3030303,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0x89898989,
+  0xffffffff,0xe9e9e9e9,0x3030303,0,0xe06080a,0xff739bb8,0x7f394d5c,0x6a30404c,0xf66f96b2,0x6a62530a,0xfbeec710,0x43403504,0x3f3c3204,0x80796508,
+  0x4e4a3e05,0x17161201,0x403d3304,0x25231d02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0x27251f02,0x403d3304,0x19181402,0x423e3404,0x80796508,0x655f5006,0x8070600,0xa49c820a,0x623a4034,0xff739bb8,0x200e1317,0xca5b7a91,0xc358768c,
+  0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0,0,0,0,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0xe0e0e0e,0xf9f9f9f9,0xffffffff,0x70707070,0,0,
+  0x38352c03,0xfff2ca10,0xfff2ca10,0xefe3bd0f,0x90897209,0,0xafa68b0b,0xf1e5bf0f,0xfff2ca10,0xfef1ca10,0x17161201,0,0x8080808,0xf3f3f3f3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9d9d9d9d,0,0,0x68686868,0xffffffff,0xffffffff,0x22222222,0x52525252,0xffffffff,0xffffffff,0x27272727,
+  0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x29292929,0,0,0,0xcbcbcbcb,
+  0xffffffff,0x96969696,0,0,0x50505050,0xffffffff,0xf4f4f4f4,0,0,0,0x1010101,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x13131313,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0x64646464,0xffffffff,0xfefefefe,0x15151515,0,0xe06080a,
+  0xff739bb8,0x7f394d5c,0x6a30404c,0xf66f96b2,0x6861520a,0x77715e07,0x14131001,0x7a746108,0x7f786408,0x16151101,0x322f2803,0x403d3304,0xe0d0b01,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xd0c0a01,0x403c3204,0x38352c04,0x9080701,
+  0x706a5807,0x80796508,0x544f4205,0x7060500,0x49232d32,0xff739bb8,0x210f1418,0xc85a7a91,0xc358778d,0,0,0xb5b5b5b5,0xffffffff,0xdadadada,0,0,
+  0,0,0,0,0x1e1e1e1e,0xffffffff,0xffffffff,0x6c6c6c6c,0x1010101,0xe2e2e2e2,0xffffffff,0x97979797,0,0,0x23211c02,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xa199800a,0,0xc2b89a0c,0xfff2ca10,0xfff2ca10,0xfaedc610,0x7070500,0,0x1010101,0xdbdbdbdb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x7c7c7c7c,0,0,0x68686868,0xffffffff,0xffffffff,0x22222222,0x2d2d2d2d,0xffffffff,0xffffffff,0x4d4d4d4d,0,0,0xdbdbdbdb,0xffffffff,0xa2a2a2a2,
+  0,0x91919191,0xffffffff,0xeaeaeaea,0x3030303,0,0x1c1c1c1c,0xffffffff,0xffffffff,0x29292929,0,0,0,0xcbcbcbcb,0xffffffff,0x96969696,0,0,0x50505050,
+  0xffffffff,0xf4f4f4f4,0,0,0,0x1010101,0xfefefefe,0xffffffff,0x61616161,0,0,0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x13131313,0,0x7a7a7a7a,0xffffffff,0xffffffff,0x10101010,0x3f3f3f3f,0xffffffff,0xffffffff,0x3b3b3b3b,0,0xf07090b,0xff739bb8,0x7e394d5b,0x6b30414d,
+  0xf66f95b1,0x18141205,0x9080701,0x68635207,0x80796508,0x4e4a3d05,0x100f0d01,0x403c3204,0x34322903,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2c2a2303,0x403d3304,0x21201a02,0x1f1d1802,0x7d766308,0x80796508,0x5d584a06,
+  0x3f1f2729,0xff739bb8,0x2c141b20,0xbd557388,0xd560819a,0,0,0xadadadad,0xf4f4f4f4,0xd0d0d0d0,0,0,0,0,0,0,0x1c1c1c1c,0xf4f4f4f4,0xf4f4f4f4,0x67676767,
+  0,0xb6b6b6b6,0xf4f4f4f4,0xb5b5b5b5,0,0,0x1010000,0xb0a78c0b,0xfef1c910,0xfff2ca10,0x9f977e0a,0,0xc0b6980c,0xfff2ca10,0xfdf0c910,0x918a7309,
+  0,0,0,0x66666666,0xfafafafa,0xffffffff,0xffffffff,0xffffffff,0xe2e2e2e2,0x1c1c1c1c,0,0,0x63636363,0xf4f4f4f4,0xf4f4f4f4,0x20202020,0xe0e0e0e,
+  0xefefefef,0xf4f4f4f4,0x6e6e6e6e,0,0,0xd1d1d1d1,0xf4f4f4f4,0x9b9b9b9b,0,0x8a8a8a8a,0xf4f4f4f4,0xdfdfdfdf,0x3030303,0,0x1a1a1a1a,0xf4f4f4f4,
+  0xf4f4f4f4,0x27272727,0,0,0,0xc2c2c2c2,0xf4f4f4f4,0x8f8f8f8f,0,0,0x4d4d4d4d,0xf4f4f4f4,0xe9e9e9e9,0,0,0,0x1010101,0xf3f3f3f3,0xf4f4f4f4,0x5d5d5d5d,
+  0,0,0x7f7f7f7f,0xf4f4f4f4,0xf4f4f4f4,0xf4f4f4f4,0xf4f4f4f4,0xf4f4f4f4,0x12121212,0,0x74747474,0xf4f4f4f4,0xf4f4f4f4,0xf0f0f0f,0x1b1b1b1b,0xf3f3f3f3,
+  0xf4f4f4f4,0x5d5d5d5d,0,0x200f1417,0xff739bb8,0x73344653,0x75354755,0xee6c91ac,0xe0c0b03,0x635e4e06,0x80796508,0x726c5a07,0xb0b0901,0x33312903,
+  0x403d3304,0x16151101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb0a0901,0x3e3b3104,
+  0x3e3b3104,0x11100d01,0x302e2603,0x7e786408,0x80796508,0x442c2e1e,0xff739bb8,0x441f2a31,0x9f486173,0xf46e94b0,0xb050708,0,0xd0d0d0d,0x12121212,
+  0xf0f0f0f,0,0,0,0,0,0,0x2020202,0x12121212,0x12121212,0x8080808,0,0xc0c0c0c,0x12121212,0xf0f0f0f,0,0,0,0x6050400,0x24221d02,0x27251f02,0x15141101,
+  0,0x1a191502,0x27251f02,0x22201b02,0x3030200,0,0,0,0,0x1f1f1f1f,0x31313131,0x31313131,0x2f2f2f2f,0xe0e0e0e,0,0,0,0x7070707,0x12121212,0x12121212,
+  0x2020202,0,0x11111111,0x12121212,0x9090909,0,0,0xf0f0f0f,0x12121212,0xb0b0b0b,0,0xa0a0a0a,0x12121212,0x11111111,0,0,0x2020202,0x12121212,0x12121212,
+  0x3030303,0,0,0,0xe0e0e0e,0x12121212,0xb0b0b0b,0,0,0x6060606,0x12121212,0x11111111,0,0,0,0,0x12121212,0x12121212,0x7070707,0,0,0x9090909,0x12121212,
+  0x12121212,0x12121212,0x12121212,0x12121212,0x1010101,0,0x9090909,0x12121212,0x12121212,0x1010101,0x1010101,0x12121212,0x12121212,0x8080808,
+  0,0x4c222e37,0xff739bb8,0x5426333c,0x90415768,0xdc63869f,0x413e3304,0x80796508,0x7a746108,0x1d1c1702,0x1f1e1902,0x403d3304,0x34312903,0x1010100,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1e1d1802,0x403d3304,0x3b382f04,
+  0xc0b0901,0x2b292203,0x78725f08,0x362e290a,0xf66f95b1,0x6f324350,0x6b30414d,0xff739bb8,0x4c222e37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x99455d6e,0xfd729ab7,0x210f1417,0xbc557288,0xb7536f84,0x524e4105,0x77715e07,0x21201a02,0x14131001,0x3f3c3204,0x3f3c3204,
+  0xe0e0b01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x2d2b2403,
+  0x403d3304,0x3b382f04,0x11100d01,0x12110e01,0x22201b02,0xd05e7f96,0xae4e6a7d,0x220f1519,0xfd729ab7,0xc056748a,0x2010101,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1b0c1013,0xf26d93ae,0xd05e7f96,0xa040607,0xf36d93af,0x833b505f,0x48443905,0x13120f01,0x14131001,0x3d3a3104,
+  0x403d3304,0x211f1a02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4030300,
+  0x322f2703,0x403d3304,0x3f3c3204,0x23221c02,0x5050400,0x883e5362,0xf26d93af,0x10070a0c,0xb7536f84,0xff739bb8,0x72334552,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x6030404,0xb5526e83,0xff739bb8,0x692f404c,0x5125313a,0xff739bb8,0x3f1c262d,0x3030200,0x211f1a02,0x3f3c3204,
+  0x403d3304,0x2d2a2303,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0x3030300,0x2d2b2403,0x403d3304,0x403d3304,0x3c393004,0x3a1d2426,0xfe739bb7,0x70334451,0x30161d23,0xf76f96b2,0xfd729ab6,0x8f415767,0x23101519,
+  0xc060709,0xc050708,0xb050708,0xb050708,0xb050708,0xb050608,0xa050607,0xa050607,0xa040607,0xa040607,0x9040607,0x9040607,0x9040506,0x9040506,
+  0x8040506,0x8040506,0x8040506,0x8030506,0x8030505,0x7030405,0x7030405,0x7030405,0x7030405,0x6030405,0x6030404,0x6030404,0x6030304,0x5020304,
+  0x5020304,0x5020304,0x5020303,0x4020303,0x4020303,0x4020203,0x4020203,0x4020203,0x3010202,0x3010202,0x3010202,0x3010202,0x2010102,0x2010101,
+  0x2010101,0x2010101,0x1010101,0x1000101,0x1000101,0x1000000,0x1000000,0x1000101,0x1010101,0x1010101,0x2010101,0x2010101,0x2010102,0x2010102,
+  0x3010202,0x3010202,0x3010202,0x3010202,0x4020203,0x4020203,0x4020203,0x4020303,0x4020303,0x5020303,0x5020304,0x5020304,0x5020304,0x6030304,
+  0x6030404,0x6030404,0x6030405,0x7030405,0x7030405,0x7030405,0x7030405,0x8030505,0x8040506,0x8040506,0x8040506,0x9040506,0x9040506,0x9040506,
+  0x9040607,0x9040607,0xa040607,0xa040607,0xa050607,0xa050608,0xb050608,0xb050708,0xb050708,0xb050708,0xc050708,0xe06080a,0x35182026,0xbb547187,
+  0xff739bb8,0xd4608199,0x8040506,0xbe567389,0xe16689a3,0x16121005,0x37342c03,0x403d3304,0x403d3304,0x2d2b2403,0x2020200,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x1c1a1602,0x3d3a3004,0x403d3304,
+  0x1f1d1802,0xc258768c,0xe9698ea8,0x150a0d0f,0x622c3c47,0xfc7299b6,0xff739bb8,0xfb7198b5,0xf16d93ae,0xf16d92ae,0xf16c92ae,0xf06c92ad,0xf06c92ad,
+  0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xef6c92ad,0xef6c91ad,0xef6c91ad,0xef6c91ac,0xef6c91ac,0xef6c91ac,0xef6c91ac,0xef6c91ac,
+  0xee6c91ac,0xee6b91ac,0xee6b91ac,0xee6b91ac,0xee6b91ac,0xee6b90ac,0xee6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,
+  0xed6b90ab,0xec6b90ab,0xec6b90ab,0xec6b90aa,0xec6a8faa,0xec6a8faa,0xec6a8faa,0xec6a8faa,0xec6a8faa,0xeb6a8faa,0xeb6a8faa,0xeb6a8faa,0xeb6a8faa,
+  0xeb6a8fa9,0xeb6a8fa9,0xeb6a8fa9,0xea6a8ea9,0xea6a8fa9,0xeb6a8fa9,0xeb6a8fa9,0xeb6a8fa9,0xeb6a8faa,0xeb6a8faa,0xeb6a8faa,0xeb6a8faa,0xec6a8faa,
+  0xec6a8faa,0xec6a8faa,0xec6a8faa,0xec6a90aa,0xec6b90aa,0xec6b90ab,0xec6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,
+  0xed6b90ab,0xee6b90ab,0xee6b90ac,0xee6b91ac,0xee6b91ac,0xee6b91ac,0xee6b91ac,0xee6c91ac,0xef6c91ac,0xef6c91ac,0xef6c91ac,0xef6c91ac,0xef6c91ad,
+  0xef6c91ad,0xef6c91ad,0xef6c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf06c92ad,0xf16d92ae,0xf16d92ae,0xf26d93af,
+  0xfe729ab7,0xff739bb8,0xeb6a8faa,0x2d141c21,0x4d232f37,0xfe739ab7,0x7b384b58,0x32302803,0x403d3304,0x3f3c3204,0x23211c02,0x2010100,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5050400,0x201e1902,0x2e2c2503,
+  0x3d1d262b,0xfb7199b5,0xb8537084,0x7030405,0x4b222e36,0xd861839c,0xfe739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xfb7198b5,
+  0xbb547287,0x2611171b,0x1f0e1317,0xe6688ca6,0xe6688ca6,0x1e16160b,0x3f3b3204,0x302d2603,0xe0d0b01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x8f405767,0xff739bb8,0xb3516d81,0x13080b0e,
+  0x6030404,0x2e151c21,0x441e2931,0x441f2a31,0x451f2a32,0x451f2a32,0x451f2a32,0x461f2a32,0x461f2a32,0x46202b33,0x46202b33,0x47202b33,0x47202b33,
+  0x47202b33,0x48202c34,0x48202c34,0x48212c34,0x49212c34,0x49212c35,0x49212c35,0x49212d35,0x4a212d35,0x4a212d35,0x4a222d36,0x4b222d36,0x4b222e36,
+  0x4b222e36,0x4b222e36,0x4c222e37,0x4c222e37,0x4c222e37,0x4d232f37,0x4d232f38,0x4d232f38,0x4e232f38,0x4e232f38,0x4e233038,0x4e233039,0x4f243039,
+  0x4f243039,0x4f243039,0x50243039,0x5024313a,0x5024313a,0x5124313a,0x5124313a,0x5125313b,0x5125323b,0x5225323b,0x5225323b,0x5225323b,0x5225323b,
+  0x5125313b,0x5125313a,0x5124313a,0x5024313a,0x5024313a,0x5024313a,0x50243039,0x4f243039,0x4f243039,0x4f233039,0x4e233039,0x4e232f38,0x4e232f38,
+  0x4d232f38,0x4d232f38,0x4d232f37,0x4d232f37,0x4c222e37,0x4c222e37,0x4c222e37,0x4b222e36,0x4b222e36,0x4b222d36,0x4a222d36,0x4a212d35,0x4a212d35,
+  0x4a212d35,0x49212d35,0x49212c35,0x49212c34,0x48212c34,0x48202c34,0x48202c34,0x47202b34,0x47202b33,0x47202b33,0x47202b33,0x46202b33,0x46202b32,
+  0x461f2a32,0x451f2a32,0x451f2a32,0x451f2a32,0x451f2a31,0x441f2931,0x411d272f,0x210f1418,0x1010101,0x2e151c21,0xda63859e,0xfd729ab7,0x5225323b,
+  0x100f0d01,0xa0a0801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x4020203,0xaf4f6a7e,0xff739bb8,0xe8698da7,0x7f394d5b,0x3c1b242b,0x2812181d,0x2712181c,0x2712181c,0x2711171c,0x2611171c,
+  0x2611171b,0x2611171b,0x2511171b,0x2511171b,0x2511161b,0x2410161a,0x2410161a,0x2410161a,0x2410161a,0x23101519,0x23101519,0x23101519,0x22101519,
+  0x220f1519,0x220f1518,0x220f1418,0x210f1418,0x210f1418,0x210f1418,0x200f1417,0x200e1317,0x200e1317,0x1f0e1317,0x1f0e1316,0x1f0e1316,0x1f0e1316,
+  0x1e0e1216,0x1e0e1216,0x1e0d1215,0x1d0d1215,0x1d0d1215,0x1d0d1115,0x1c0d1115,0x1c0d1114,0x1c0d1114,0x1c0c1114,0x1b0c1114,0x1b0c1013,0x1b0c1013,
+  0x1a0c1013,0x1a0c1013,0x1a0c1013,0x190b0f12,0x1a0c1012,0x1a0c1013,0x1a0c1013,0x1a0c1013,0x1b0c1013,0x1b0c1014,0x1b0c1114,0x1c0c1114,0x1c0d1114,
+  0x1c0d1114,0x1d0d1115,0x1d0d1215,0x1d0d1215,0x1d0d1215,0x1e0d1215,0x1e0e1216,0x1e0e1216,0x1f0e1316,0x1f0e1316,0x1f0e1317,0x200e1317,0x200e1317,
+  0x200f1417,0x200f1417,0x210f1418,0x210f1418,0x210f1418,0x220f1418,0x220f1519,0x220f1519,0x23101519,0x23101519,0x23101519,0x2310161a,0x2410161a,
+  0x2410161a,0x2410161a,0x2511161a,0x2511161b,0x2511171b,0x2611171b,0x2611171b,0x2611171b,0x2611171c,0x2711181c,0x2712181c,0x2712181c,0x2b131a1f,
+  0x49212d35,0x9a465e6f,0xf97097b3,0xfd729ab7,0x7c384b59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x6030404,0x8d405666,0xfa7198b5,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xf06c92ad,0x652e3d49,0x1000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x30151d22,0x9342596a,0xca5b7b92,0xdf6588a1,
+  0xe06588a2,0xe06588a2,0xe16588a2,0xe16589a2,0xe16689a2,0xe16689a3,0xe26689a3,0xe26689a3,0xe2668aa3,0xe3668aa4,0xe3668aa4,0xe3668aa4,0xe4678aa4,
+  0xe4678aa4,0xe4678ba5,0xe4678ba5,0xe5678ba5,0xe5678ba5,0xe5678ba5,0xe6688ca6,0xe6688ca6,0xe6688ca6,0xe7688ca6,0xe7688ca7,0xe7688ca7,0xe7688da7,
+  0xe8688da7,0xe8698da7,0xe8698da8,0xe9698da8,0xe9698ea8,0xe9698ea8,0xe9698ea8,0xea698ea9,0xea6a8ea9,0xea6a8ea9,0xeb6a8fa9,0xeb6a8faa,0xeb6a8faa,
+  0xec6a8faa,0xec6a8faa,0xec6b90aa,0xec6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xee6b90ab,0xee6b90ab,0xed6b90ab,0xed6b90ab,0xed6b90ab,0xec6b90ab,
+  0xec6a8faa,0xec6a8faa,0xeb6a8faa,0xeb6a8faa,0xeb6a8fa9,0xeb6a8fa9,0xea6a8ea9,0xea6a8ea9,0xea698ea9,0xe9698ea8,0xe9698ea8,0xe9698da8,0xe8698da8,
+  0xe8698da7,0xe8698da7,0xe8688da7,0xe7688da7,0xe7688ca7,0xe7688ca6,0xe6688ca6,0xe6688ca6,0xe6688ca6,0xe5678ba6,0xe5678ba5,0xe5678ba5,0xe5678ba5,
+  0xe4678ba5,0xe4678ba5,0xe4678aa4,0xe3678aa4,0xe3668aa4,0xe3668aa4,0xe3668aa3,0xe2668aa3,0xe26689a3,0xe26689a3,0xe16689a3,0xe16589a2,0xe16589a2,
+  0xe06588a2,0xe06588a2,0xe06588a2,0xdd64869f,0xc257768c,0x7e394d5b,0x1a0c1013,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+static const unsigned int temp2[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0x16161616,0x3f3f3f3f,0x43434343,0x43434343,0x43434343,0x43434343,0x43434343,0x43434343,0x43434343,0x31313131,0x6060606,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3030303,0x73737373,
+  0xc7c7c7c7,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xbcbcbcbc,0x57575757,0x1010101,0,0,0,0,0,0xe0e0e0e,
+  0xd0d0d0d0,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xcdcdcdcd,0x16161616,0,0,0x4d4d4d4d,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xa6a6a6a6,0,0,
+  0,0,0,0x6e6e6e6e,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd0d0d0d0,0x9b9b9b9b,0x1f1f1f1f,
+  0,0,0,0,0,0,0x8e8e8e8e,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,
+  0xd8d8d8d8,0x5b5b5b5b,0,0,0,0,0,0x51515151,0xe8e8e8e8,0xf7f7f7f7,0xf9f9f9f9,0xf9f9f9f9,0xf9f9f9f9,0xf9f9f9f9,0xf9f9f9f9,0xf9f9f9f9,0xf9f9f9f9,
+  0xf3f3f3f3,0xbabababa,0x13131313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0x80808080,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfbfbfbfb,
+  0x56565656,0,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xe5e5e5e5,0x25252525,0,0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,0,0,0,0,0x1c1c1c1c,0xf1f1f1f1,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9a9a9a9a,0x1010101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf0f0f0f,0xecececec,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcdcdcdcd,0x2020202,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,
+  0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xaeaeaeae,0x2020202,
+  0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x6b6b6b6b,0,0,0,0,0x72727272,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xedededed,0x13131313,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x39393939,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0xf0f0f0f,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,
+  0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3f3f3f3,0x1f1f1f1f,0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,0,0,0,0,0x9b9b9b9b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x2c2c2c2c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x56565656,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x2b2b2b2b,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4f4f4f4f,0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,0,0,0,0,0xb2b2b2b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x43434343,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,
+  0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x6c6c6c6c,0,0,0,0,0xa6a6a6a6,0xfdfdfdfd,0xfdfdfdfd,0xfdfdfdfd,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0xfdfdfdfd,
+  0xfdfdfdfd,0xfdfdfdfd,0x6b6b6b6b,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf3f3f3f3,0xe5e5e5e5,0xe5e5e5e5,0xe8e8e8e8,
+  0xfdfdfdfd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xefefefef,0x92929292,0x8d8d8d8d,0x9b9b9b9b,
+  0xfafafafa,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,
+  0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc7c7c7c7,0x7c7c7c7c,0x7c7c7c7c,0x85858585,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x76767676,0,0,0,0,0x32323232,0x4c4c4c4c,
+  0x4c4c4c4c,0x4c4c4c4c,0xaaaaaaaa,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x7f7f7f7f,0x4c4c4c4c,0x4c4c4c4c,0x4c4c4c4c,0x20202020,0,0,0,0,
+  0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x65656565,0,0,0x3030303,0xd6d6d6d6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xa8a8a8a8,0,0,0,0xd3d3d3d3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,
+  0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0xa6a6a6a6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,
+  0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,
+  0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,
+  0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,
+  0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,
+  0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,
+  0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,
+  0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,
+  0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,
+  0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3030303,0x3030303,0x3030303,0x3030303,
+  0x3030303,0x3030303,0x3030303,0,0x1010101,0x3030303,0x3030303,0x2020202,0,0x1010101,0x3030303,0x3030303,0x2020202,0,0x2020202,0x3030303,0x3030303,
+  0x3030303,0x3030303,0x3030303,0x2020202,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,
+  0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4040404,0x9f9f9f9f,0xc1c1c1c1,0xc1c1c1c1,0xc1c1c1c1,0xc1c1c1c1,0xc1c1c1c1,
+  0xc1c1c1c1,0x1d1d1d1d,0x2e2e2e2e,0xc1c1c1c1,0xc1c1c1c1,0x63636363,0,0x28282828,0xc1c1c1c1,0xc1c1c1c1,0x69696969,0,0x65656565,0xc1c1c1c1,0xc1c1c1c1,
+  0xc1c1c1c1,0xc1c1c1c1,0xc1c1c1c1,0x7e7e7e7e,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,
+  0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5050505,0xd2d2d2d2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x26262626,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,
+  0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5050505,0xd2d2d2d2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x26262626,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,
+  0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3030303,0x96969696,0xb6b6b6b6,0xecececec,0xffffffff,0xfbfbfbfb,0xbdbdbdbd,
+  0xb6b6b6b6,0x1b1b1b1b,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,
+  0xcbcbcbcb,0xb6b6b6b6,0xb6b6b6b6,0x77777777,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,
+  0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020202,0x3030303,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x1c1c1c1c,0x3030303,
+  0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x4a4a4a4a,0x3030303,
+  0x3030303,0x2020202,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0x1010101,0x1010101,0x1010101,0xc9c9c9c9,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,
+  0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,
+  0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdcdcdcdc,0xa4a4a4a4,0xa4a4a4a4,0xa4a4a4a4,0xecececec,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,
+  0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,
+  0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,
+  0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,
+  0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,
+  0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,
+  0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,
+  0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xbcbcbcbc,
+  0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,
+  0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,
+  0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x45454545,0,0,0,0x1000001,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,
+  0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000101,0x1000001,0x1000001,0x1000001,
+  0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000001,0x1000000,0x1000000,
+  0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,
+  0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0x1000000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2010101,0x14090c0f,0x5024313a,
+  0x7c384b59,0x9c465f71,0xb4516d82,0xb7526f84,0x9b465e70,0x4020203,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,
+  0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0xab4d687b,0xe4678aa4,
+  0xe3668aa4,0xe26689a3,0xe16689a3,0xe16589a2,0xe06588a1,0xdf6588a1,0xde6487a0,0xde6487a0,0xdd63869f,0xdc63869f,0xdb63859e,0xda63859e,0xd962849d,
+  0xd962849c,0xd861839c,0xd761839b,0xd661829b,0xd660829a,0xd560819a,0xd4608199,0xd35f8199,0xd35f8098,0xd25f8097,0xd15e7f97,0xd05e7f96,0xd05e7e96,
+  0xcf5d7e95,0xce5d7d95,0xcd5d7d94,0xcd5c7c94,0xcc5c7c93,0xcb5c7b92,0xca5b7b92,0xca5b7a91,0xc95b7a91,0xc85a7a90,0xc75a7990,0xc659798f,0xc659788f,
+  0xc559788e,0xc459778e,0xc358778d,0xc358768c,0xc257768c,0xc157758b,0xc057758b,0xc056758a,0xbf56748a,0xbe567489,0xbd557389,0xbd557388,0xbc557288,
+  0xbb547287,0xba547186,0xba547186,0xb9537085,0xb8537085,0xb7536f84,0xb6526f84,0xb6526e83,0xab4d687b,0x8f415767,0x662e3e49,0x23101519,0x8030505,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1000000,0x31161e23,0x9a465e6f,0xe4678ba5,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xd861839c,
+  0x5020304,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x94949494,0x25252525,0x52525252,0xffffffff,
+  0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x97979797,0x6f6f6f6f,0x68686868,0xa0a0a0a,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,
+  0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,
+  0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,
+  0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0xbf56748a,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xf87097b3,0xbb547287,0x4d232f37,0xa040607,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x10070a0c,0x803a4e5c,0xed6b90ab,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xd861839c,
+  0x5020304,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0xf6f6f6f6,0xedededed,0xf1f1f1f1,0xffffffff,
+  0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x17171717,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xc7c7c7c7,0x6c6c6c6c,0x6c6c6c6c,0x6c6c6c6c,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,
+  0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,
+  0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,
+  0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0xbf56748a,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xfa7198b5,0xb5526e83,
+  0x2913191e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1a0c1013,0xc057758a,0xfe729ab7,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xd861839c,0x5020304,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x17171717,0,0,0,0,0,0x5e5e5e5e,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,
+  0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,
+  0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,
+  0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0xbf56748a,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xe6688ca6,0x5426333d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020200,0xc0b0901,0x1b191502,0x24221c02,0x22201b02,0x1010100,0x220f1518,0xd35f8098,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xfa7198b5,0xd35f8098,0x98445c6d,0x75354755,0x5b293842,0x58283640,0x4a212d35,0x2010101,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,
+  0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0xfefefefe,0xfcfcfcfc,0xfdfdfdfd,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0xf7f7f7f7,
+  0xf4f4f4f4,0xe5e5e5e5,0x16161616,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,
+  0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,
+  0,0,0,0x200e1317,0x2b131a1f,0x2c141a1f,0x2c141b20,0x2d141b21,0x2e151c21,0x2f151c22,0x30151d22,0x30161d23,0x31161e23,0x32161e24,0x33171f25,0x33171f25,
+  0x34182026,0x35182026,0x36182127,0x36192127,0x37192228,0x38192229,0x391a2329,0x3a1a232a,0x3a1a232a,0x3b1b242b,0x3c1b242b,0x3d1b252c,0x3d1c252c,
+  0x3e1c262d,0x3f1c262d,0x401d272e,0x411d272f,0x411d282f,0x421e2830,0x431e2930,0x441f2931,0x441f2a31,0x451f2a32,0x46202a32,0x47202b33,0x48202b34,
+  0x48212c34,0x49212c35,0x4a212d35,0x4a222d36,0x4b222e36,0x4c222e37,0x4d232f37,0x4e232f38,0x4e233039,0x4f243039,0x5024313a,0x5124313a,0x5125323b,
+  0x5225323b,0x5325323c,0x5426333d,0x5526333d,0x5526343e,0x5627343e,0x5727353f,0x5828353f,0x58283640,0x59283640,0x672f3f4b,0x883d5362,0xba547186,
+  0xf66f95b1,0xfe739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xf87097b3,0x622c3c47,0x1010101,0,0x1010000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020200,0xe0d0b01,0x25231d02,0x39362d04,0x403d3304,
+  0x403d3304,0x3d3a3004,0x100f0d01,0x14090c0f,0xd861839c,0xff739bb8,0xff739bb8,0xff739bb8,0xf87096b3,0xa54a6477,0x3c1b242b,0x2010102,0,0,0,0,
+  0,0,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0xa7a7a7a7,0x4a4a4a4a,0x70707070,0xffffffff,0xffffffff,
+  0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,
+  0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,
+  0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1e0e1216,0x823b4f5e,0xec6a8faa,0xff739bb8,0xff739bb8,0xff739bb8,0xfb7198b5,0x612c3b46,0x1000101,0x1b1a1502,
+  0x23211b02,0x16151101,0x8070600,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x11100d01,0x2f2c2503,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x403c3204,0x1f1d1802,0x8040506,0xaf4f6a7e,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xdd6486a0,0x5325323c,0x2010101,0,0,0,0,0,0,0,0,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,
+  0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,
+  0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,
+  0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2c141b20,0xb6526e83,0xfe729ab7,
+  0xff739bb8,0xff739bb8,0xf06c92ad,0x3f1c262d,0x8070600,0x3a372e04,0x403d3304,0x3b382f04,0x2c2a2303,0x15141101,0x3030200,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x8070600,0x2a282103,0x3e3b3104,0x403d3304,
+  0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x34322903,0x3030200,0x79374a58,0xfd729ab7,0xff739bb8,0xff739bb8,0xd35f8199,0x2812181d,0,0,0,0xd060809,
+  0x431e2830,0x622c3b47,0x7c384b59,0x7f394d5c,0x6c31424e,0x3010202,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,
+  0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,
+  0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1a1a1a1a,0,0,0x5b5b5b5b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc4c4c4c4,0,0,
+  0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0x9e9e9e9e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x77777777,
+  0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x60606060,0,0,0,0xcececece,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0x813a4f5d,0xac4e697c,0xab4d687c,0xab4d687b,
+  0xaa4d677b,0xa94c677a,0xa84c6679,0xa84c6679,0xa74b6578,0xa64b6578,0xa54b6477,0xa54a6477,0xa44a6476,0xa34a6376,0xa2496375,0xa1496274,0xa1486274,
+  0xa0486173,0x9f486173,0x9e476072,0x9e476072,0x9d475f71,0x9c465f71,0x9b465e70,0x9a465e6f,0x9a455d6f,0x99455d6e,0x98455d6e,0x97445c6d,0x97445c6d,
+  0x96445b6c,0x95435b6c,0x94435a6b,0x93435a6a,0x9342596a,0x92425969,0x91425869,0x91415868,0x90415768,0x8f405767,0x8e405667,0x8d405666,0x8d3f5666,
+  0x8c3f5565,0x8b3f5464,0x8a3e5464,0x8a3e5463,0x893e5363,0x883d5362,0x873d5262,0x863d5261,0x863c5160,0x853c5160,0x843c505f,0x833b505f,0x833b4f5e,
+  0x823b4f5e,0x813a4e5d,0x803a4e5d,0x7f394d5c,0x7f394d5b,0x7e394d5b,0x70324451,0x5124313a,0x1f0e1316,0,0,0,0xe06080a,0x99455d6f,0xfe729ab7,0xff739bb8,
+  0xff739bb8,0xda62859e,0x160a0d10,0x17161201,0x403c3204,0x403d3304,0x403d3304,0x3f3c3204,0x322f2803,0x16151201,0x2010100,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x15141001,0x39362d04,0x403d3304,0x403d3304,0x403d3304,
+  0x403d3304,0x403d3304,0x403d3304,0x403c3204,0x14131001,0x2611171c,0xee6b91ac,0xff739bb8,0xff739bb8,0xd962849c,0x220f1519,0,0,0xe06090a,0x833b4f5e,
+  0xdc63869f,0xf87097b3,0xff739bb8,0xff739bb8,0xff739bb8,0xd861839c,0x5020304,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,
+  0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,
+  0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,
+  0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x21212121,0,0,0x64646464,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc4c4c4c4,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa0a0a0a0,0x21212121,0x21212121,0x2a2a2a2a,0xd1d1d1d1,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x77777777,0,0,0,0,0,0,0,0,0x86868686,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x49494949,0,0,0,0,0,0,0,
+  0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x62626262,0,0,0x1010101,0xd2d2d2d2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,
+  0,0,0,0xbf56748a,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xfd729ab6,0xeb6a8faa,
+  0xab4d687b,0x2812181d,0,0,0x6030405,0x97445c6d,0xff739bb8,0xff739bb8,0xff739bb8,0x94435a6b,0x2010100,0x312e2703,0x403d3304,0x403d3304,0x403d3304,
+  0x403d3304,0x3f3c3204,0x2d2b2403,0x8080701,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0x1010100,0x1f1e1902,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x3f3b3204,0x2d2a2303,0x4020203,0xad4e697d,
+  0xff739bb8,0xff739bb8,0xf26d93ae,0x34182026,0,0,0x3d1c252c,0xdb63859e,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xd861839c,
+  0x5020304,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,
+  0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,
+  0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0x11111111,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xf0f0f0f0,0xeaeaeaea,0xeaeaeaea,0xf6f6f6f6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc3c3c3c3,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xfdfdfdfd,0xfbfbfbfb,0xfbfbfbfb,0xfcfcfcfc,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x71717171,0,0,0,0,
+  0x9a9a9a9a,0xeaeaeaea,0xeaeaeaea,0xeaeaeaea,0xf5f5f5f5,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0xeaeaeaea,0xeaeaeaea,0xeaeaeaea,
+  0x62626262,0,0,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe4e4e4e4,0xc9c9c9c9,0xc9c9c9c9,0xcccccccc,0xfafafafa,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0xbf56748a,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xf56f95b1,0x76354855,0x5020304,0,0x7030405,0xb8537085,0xff739bb8,0xff739bb8,0xfc7299b6,
+  0x3a1a232a,0x12110e01,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x3c392f04,0x17161301,0x1010100,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020200,0x27251f02,0x403d3304,0x403d3304,0x403d3304,0x403d3304,
+  0x403d3304,0x403d3304,0x3b382e04,0x29272003,0x12110e01,0x1010100,0x401d272e,0xfc7299b6,0xff739bb8,0xff739bb8,0x692f404c,0,0,0x4b222e36,0xf06c92ad,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xd861839c,0x5020304,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,
+  0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x48484848,
+  0,0,0,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x33333333,0,0,0,0,0xc0c0c0c,0xe7e7e7e7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xafafafaf,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x5d5d5d5d,0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,0,0,0,0,0xb3b3b3b3,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x45454545,0,0,0,0xbf56748a,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xfd729ab7,0x95435b6c,0x9040607,0,0x1a0c1012,0xe16589a2,0xff739bb8,0xff739bb8,0xb7526f84,0x3020201,0x2e2c2503,0x403d3304,0x403d3304,
+  0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x3f3c3204,0x211f1a02,0x2020200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020200,0x26251e02,0x403c3204,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x3e3b3104,0x28262003,0xa090801,0,
+  0,0x1010101,0xad4e697d,0xff739bb8,0xff739bb8,0xc85a7990,0x5020303,0,0x38192228,0xed6b90ab,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xf87097b3,0xe7688da7,0xe6688ca6,0xc258768c,0x5020303,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,
+  0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0x56565656,0x14141414,0x14141414,0xd0d0d0d,0,0,
+  0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,
+  0,0,0,0,0x4040404,0xd0d0d0d0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x90909090,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfcfcfcfc,0x31313131,0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,0,0,0,0,0xa5a5a5a5,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x35353535,0,0,0,0x9f486173,0xd4608199,
+  0xd5608199,0xd560819a,0xd560829a,0xd660829a,0xd660829a,0xd661829b,0xd661829b,0xd761839b,0xd761839b,0xd761839b,0xd861839c,0xd861839c,0xd862839c,
+  0xd862849c,0xd962849c,0xd962849d,0xd962849d,0xda62849d,0xda62859d,0xda62859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdc63859e,0xdc63869f,0xdc63869f,
+  0xdd63869f,0xdd64869f,0xdd6486a0,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xdf6487a1,0xdf6588a1,0xdf6588a1,0xe06588a1,0xe06588a2,0xe06588a2,
+  0xe16589a2,0xe16589a2,0xe16689a2,0xe16689a3,0xe26689a3,0xe26689a3,0xe2668aa3,0xe3668aa4,0xe3668aa4,0xe3678aa4,0xe4678aa4,0xe4678ba5,0xe4678ba5,
+  0xe5678ba5,0xe5678ba5,0xe5678ba5,0xe6688ca6,0xe6688ca6,0xe6688ca6,0xe7688ca6,0xe7688ca7,0xf36d94af,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xfe739ab7,0x883d5362,0x2010101,0,0x5f2b3a44,0xfc7299b6,0xff739bb8,0xfa7198b4,0x391a2329,0x7060500,0x1e1d1802,0x36332b03,0x403d3304,
+  0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x3f3c3204,0x28262003,0x3030200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x24221c02,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x36332a03,0x12110e01,0x1010100,0,0x1010100,
+  0x3030300,0x2611171b,0xf87097b3,0xff739bb8,0xfb7199b5,0x421e282f,0,0x14090c0f,0xd25f8098,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xcb5b7b92,
+  0x622c3b46,0x2c141b20,0x1e0e1216,0x1d0d1215,0x190b0f12,0x1000000,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,
+  0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0xe7e7e7e7,0xdededede,0xdededede,0x91919191,
+  0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,
+  0,0,0,0,0,0x91919191,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xfefefefe,0x4d4d4d4d,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xd2d2d2d2,0x8080808,0,0,0,0,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,0,0,0,0,0x84848484,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf7f7f7f7,0x1b1b1b1b,0,0,0,0xd060809,0x12080b0d,0x12080b0d,
+  0x12080b0d,0x12080b0d,0x12080b0d,0x13080b0d,0x13080b0e,0x13090c0e,0x13090c0e,0x13090c0e,0x14090c0e,0x14090c0e,0x14090c0e,0x14090c0f,0x14090c0f,
+  0x15090c0f,0x15090d0f,0x15090d0f,0x150a0d0f,0x150a0d0f,0x160a0d10,0x160a0d10,0x160a0d10,0x160a0d10,0x160a0e10,0x170a0e10,0x170a0e10,0x170a0e11,
+  0x170a0e11,0x170b0e11,0x180b0e11,0x180b0e11,0x180b0f11,0x180b0f11,0x180b0f12,0x190b0f12,0x190b0f12,0x190b0f12,0x190b0f12,0x190b0f12,0x1a0c1013,
+  0x1a0c1013,0x1a0c1013,0x1a0c1013,0x1b0c1013,0x1b0c1013,0x1b0c1013,0x1b0c1014,0x1b0c1114,0x1c0c1114,0x1c0d1114,0x1c0d1114,0x1c0d1114,0x1c0d1114,
+  0x1d0d1115,0x1d0d1115,0x1d0d1215,0x1d0d1215,0x1d0d1215,0x1e0d1215,0x1e0d1216,0x2611171c,0x47202b33,0x9b465e70,0xf56f95b1,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xfa7198b4,0x59283640,0,0x6030405,0xbd557389,0xff739bb8,0xff739bb8,0xa1496274,0,0,0x5050400,0x1e1d1802,0x3c393004,0x403d3304,0x403d3304,
+  0x403d3304,0x403d3304,0x403c3204,0x27251f02,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0x1a181402,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x2e2c2503,0x6060500,0,0x1010100,0x1d1c1702,0x5a554706,0xd0d0b01,0x873d5262,
+  0xff739bb8,0xff739bb8,0xba547186,0x3010202,0,0x8a3e5464,0xff739bb8,0xff739bb8,0xff739bb8,0xfa7198b4,0x76354855,0xb050708,0,0,0,0,0,0,0,0,0,
+  0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,0xffffffff,0xffffffff,0x8b8b8b8b,0,
+  0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0,0,0,0,0,0x5e5e5e5e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9e9e9e9e,0,0,0,0xc9c9c9c9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x33333333,0,0,0,0,0,0x2a2a2a2a,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd0d0d0d0,0x4040404,0,0,0,0,0,0x82828282,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfbfbfbfb,0x57575757,0,0,0,0,0,0xa7a7a7a7,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6b6b6b6b,
+  0,0,0,0,0x36363636,0xfafafafa,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xbbbbbbbb,0x3030303,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0x3010202,0x2b131a1f,0xd25f8098,0xff739bb8,0xff739bb8,0xff739bb8,0xe5678ba5,0x13090c0e,0,0x4c222e37,0xfd729ab6,0xff739bb8,
+  0xea698ea9,0x13090c0e,0,0,0,0xa0a0801,0x302e2603,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403c3204,0x25231d02,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xf0e0c01,0x3e3b3104,0x403d3304,0x403d3304,0x403d3304,0x3f3c3204,0x25231d02,0x2020100,
+  0,0x12120f01,0x59554706,0x7f796508,0x615c4d06,0x4020202,0xd962849d,0xff739bb8,0xfe729ab7,0x5124313a,0,0x2912191d,0xf56e95b1,0xff739bb8,0xff739bb8,
+  0xf87097b3,0x5a293741,0,0,0,0,0,0,0,0,0,0,0,0xbcbcbcbc,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0x3d3d3d3d,0xffffffff,0xffffffff,0x83838383,0,0x35353535,
+  0xffffffff,0xffffffff,0x8b8b8b8b,0,0x85858585,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0,0,0,0,0,0x5b5b5b5b,0xf7f7f7f7,
+  0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0x99999999,0,0,0,0xc3c3c3c3,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0x32323232,0,0,0,0,0,0,0x47474747,
+  0xdededede,0xf4f4f4f4,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf0f0f0f0,0xc4c4c4c4,0x1b1b1b1b,0,0,0,0,0,0,0x7e7e7e7e,
+  0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf5f5f5f5,0xe5e5e5e5,0x68686868,0,0,0,0,
+  0,0,0xa2a2a2a2,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,
+  0x68686868,0,0,0,0,0,0x92929292,0xfbfbfbfb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xe5e5e5e5,0x36363636,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0x13090c0e,0xbf567489,0xff739bb8,0xff739bb8,0xff739bb8,0x93425a6a,0,0x4020303,0xce5d7d95,0xff739bb8,0xff739bb8,0x5b293741,
+  0x16151201,0x2c292303,0x4040300,0,0x2020200,0x25231d02,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x1a191502,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4040300,0x36332a03,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x24221d02,
+  0x1010100,0x1010100,0x24221d02,0x726c5a07,0x80796508,0x80796508,0x3c392f04,0x2e151c21,0xfc7299b6,0xff739bb8,0xdc63869e,0xc050709,0,0x97445c6d,
+  0xff739bb8,0xff739bb8,0xff739bb8,0x823b4f5e,0,0,0,0,0,0,0,0,0,0,0,0,0x66666666,0x8b8b8b8b,0x83838383,0xe0e0e0e,0,0,0x21212121,0x8b8b8b8b,0x8b8b8b8b,
+  0x47474747,0,0x1d1d1d1d,0x8b8b8b8b,0x8b8b8b8b,0x4c4c4c4c,0,0x49494949,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x5b5b5b5b,0,0,
+  0,0,0,0x17171717,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x27272727,0,0,0,0x32323232,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0xd0d0d0d,
+  0,0,0,0,0,0,0,0xa0a0a0a,0x34343434,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x28282828,0x3030303,0,0,0,0,0,0,0,0x20202020,
+  0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x39393939,0x14141414,0,0,0,0,0,0,0,0x29292929,
+  0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x3f3f3f3f,0x1a1a1a1a,
+  0,0,0,0,0,0x4040404,0x50505050,0x85858585,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x8b8b8b8b,0x73737373,0x28282828,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0x1e0e1216,0xe06588a1,0xff739bb8,0xff739bb8,0xed6b90ab,0x1c0d1114,0,0x6e31434f,0xff739bb8,0xff739bb8,0xa84c6679,0x9090701,0x79736008,0x5c574906,
+  0x16151101,0,0,0x1d1c1702,0x3f3b3204,0x403d3304,0x403d3304,0x403d3304,0x3d393004,0xf0e0c01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x25231d02,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x29272003,0x2020200,0x2020200,0x38352c04,0x79736008,
+  0x80796508,0x80796508,0x7f796508,0x1d1b1702,0x78364956,0xff739bb8,0xff739bb8,0x95435a6b,0,0x10070a0c,0xf06c92ad,0xff739bb8,0xff739bb8,0xcb5c7b93,
+  0x9040607,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5225323c,
+  0xfa7198b5,0xff739bb8,0xff739bb8,0x79374a58,0,0x220f1518,0xfc7299b6,0xff739bb8,0xdc63869f,0xa040607,0x625d4e06,0x80796508,0x726c5a07,0x2a282203,
+  0x1010100,0x1010100,0x1e1c1802,0x3f3c3204,0x403d3304,0x403d3304,0x403d3304,0x35332a03,0x5050400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xe0d0b01,0x3e3a3104,0x403d3304,0x403d3304,0x403d3304,0x2f2c2503,0x3030300,0,0x3d3a3004,0x7e776308,0x80796508,
+  0x80796508,0x80796508,0x77715e07,0xb0a0801,0xb1506b7f,0xff739bb8,0xfe739bb8,0x4c222e37,0,0x5d2a3943,0xff739bb8,0xff739bb8,0xfd729ab6,0x4b222d36,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4020203,0xc057758b,
+  0xff739bb8,0xff739bb8,0xcc5c7c93,0x4020203,0x1000000,0xcf5d7e95,0xff739bb8,0xfb7199b5,0x2812191d,0x46433804,0x80796508,0x80796508,0x7b756208,
+  0x37352c03,0,0x1010100,0x211f1a02,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x23211b02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x2f2d2503,0x403d3304,0x403d3304,0x403d3304,0x3a372e04,0x8080701,0,0x2f2c2503,0x7e786408,0x80796508,0x80796508,
+  0x80796508,0x80796508,0x635e4f06,0x4020303,0xe06588a1,0xff739bb8,0xee6b91ac,0x14090c0e,0,0xa94c677a,0xff739bb8,0xff739bb8,0xcb5c7c93,0x6030404,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5024313a,
+  0xfe729ab7,0xff739bb8,0xf87097b3,0x2712181c,0,0x8c3f5565,0xff739bb8,0xff739bb8,0x5c293842,0x302e2603,0x80796508,0x80796508,0x80796508,0x7e786408,
+  0x38362d04,0x1010100,0x2020100,0x2c2a2303,0x403d3304,0x403d3304,0x403d3304,0x3e3b3104,0xd0d0b01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x15131001,0x403c3204,0x403d3304,0x403d3304,0x3f3b3204,0x16151101,0,0x23211b02,0x7b756208,0x80796508,0x80796508,
+  0x80796508,0x80796508,0x66615106,0x16151101,0x210f1418,0xf56f95b1,0xff739bb8,0xcf5d7e96,0,0x8040506,0xe8698da8,0xff739bb8,0xff739bb8,0x71334551,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb050708,
+  0xeb6a8faa,0xff739bb8,0xff739bb8,0x632c3c47,0,0x58283640,0xff739bb8,0xff739bb8,0x823b4f5e,0x1a191502,0x80796508,0x80796508,0x80796508,0x80796508,
+  0x7f786408,0x312e2703,0,0x5050400,0x36332b03,0x403d3304,0x403d3304,0x403d3304,0x302e2603,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x322f2703,0x403d3304,0x403d3304,0x403d3304,0x28262003,0x1010000,0xf0f0c01,0x726c5a07,0x80796508,0x80796508,
+  0x80796508,0x7f786408,0x524d4105,0x9090701,0,0x3f1d262e,0xff739bb8,0xff739bb8,0xa3496375,0,0x2812191d,0xf97097b4,0xff739bb8,0xf97097b3,0x2913191e,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xab4d687b,
+  0xff739bb8,0xff739bb8,0x90415868,0,0x2b131a1f,0xff739bb8,0xff739bb8,0xa74b6578,0x4040300,0x504c4005,0x7f786408,0x80796508,0x80796508,0x80796508,
+  0x78725f08,0x1e1d1802,0,0x11100d01,0x3f3c3204,0x403d3304,0x403d3304,0x403c3204,0x12110e01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0x11110e01,0x403c3204,0x403d3304,0x403d3304,0x3c393004,0x7070600,0x1010100,0x514d4005,0x80796508,0x80796508,0x80796508,0x80796508,
+  0x4b473c05,0x4040300,0,0,0x5627343e,0xff739bb8,0xff739bb8,0x7a374a58,0,0x4f243039,0xff739bb8,0xff739bb8,0xe06588a2,0x9040507,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x77364856,0xff739bb8,
+  0xff739bb8,0xbc557288,0x1000101,0x11070a0c,0xfb7198b5,0xff739bb8,0xc659788f,0x2010101,0x4040300,0x3e3b3104,0x7d766308,0x80796508,0x80796508,
+  0x80796508,0x6d675607,0xc0b0901,0,0x27251f02,0x403d3304,0x403d3304,0x403d3304,0x302e2603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0x2d2a2303,0x403d3304,0x403d3304,0x403d3304,0x211f1a02,0,0x25231d02,0x7d776308,0x80796508,0x80796508,0x80796508,0x58534506,
+  0x5050400,0,0x25231d02,0x2b292203,0x6b30414d,0xff739bb8,0xff739bb8,0x632d3c48,0,0x6f324350,0xff739bb8,0xff739bb8,0xb8537085,0,0,0,0,0x2020202,
+  0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x4040404,0,0,0,0,0,0,0,0,0x1010101,0x5050505,0x5050505,
+  0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0,0,0,0,0,0,0,0,0,0,0,0x17161201,0x58544606,0x67625106,0x67625106,
+  0x67625106,0x625d4e06,0xc0b0901,0,0,0x23211b02,0x67615106,0x67625106,0x67625106,0x67625106,0x4b473b05,0xa0a0801,0,0,0,0,0,0,0,0,0,0x1f1f1f1f,
+  0x5a5a5a5a,0x67676767,0x67676767,0x67676767,0x67676767,0x67676767,0x67676767,0x67676767,0x67676767,0x67676767,0x1f1f1f1f,0,0,0,0,0,0x4040404,
+  0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x2020202,0,0,0,0,0,0,0,0,0,0,0,0x3030303,0x5050505,
+  0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x4040404,0,0,0,0,0,0,0,0,0x1010101,0x5050505,0x5050505,0x5050505,0x5050505,0x1010101,0,0,
+  0,0,0,0,0,0x2020202,0x5050505,0x5050505,0x5050505,0x5050505,0x1010101,0,0,0,0,0,0x3030303,0x5050505,0x5050505,0x5050505,0x4040404,0,0,0,0,0,
+  0,0,0,0x4040404,0x5050505,0x5050505,0x5050505,0x4040404,0,0,0,0,0,0,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,
+  0x5050505,0x5050505,0x5050505,0x1010101,0,0,0,0,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,0x5050505,
+  0x1010101,0,0,0,0,0,0,0,0x4a212d36,0xff739bb8,0xff739bb8,0xd4608199,0x5020304,0x9040506,0xe7688ca6,0xff739bb8,0xd35f8199,0x4020303,0,0x1010100,
+  0x3c392f04,0x7f796508,0x80796508,0x80796508,0x80796508,0x4c483c05,0x1010100,0x6060500,0x3a372e04,0x403d3304,0x403d3304,0x3f3c3204,0x11100d01,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x8080601,0x3f3c3204,0x403d3304,0x403d3304,0x39362d04,0x4040300,0x8070600,0x6c675607,
+  0x80796508,0x80796508,0x80796508,0x625d4e06,0x7070600,0,0x32302803,0xe5dab60e,0x3d3a3104,0x813a4f5d,0xff739bb8,0xff739bb8,0x5225323b,0,0x813a4e5d,
+  0xff739bb8,0xff739bb8,0xa0486174,0,0,0,0,0x6a6a6a6a,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,
+  0xfcfcfcfc,0xfbfbfbfb,0xd4d4d4d4,0x6e6e6e6e,0x4040404,0,0,0,0,0,0x3b3b3b3b,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,
+  0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xdfdfdfdf,0x84848484,0x8080808,0,0,0,0,0,0,0,0x39362d04,0xebdfba0f,0xfef1ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0x403d3304,0,0,0x827c6708,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0xccc2a20d,0x17161201,0,0,0,0,0,0,0x2020202,
+  0x71717171,0xfafafafa,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4d4d4d4d,
+  0,0,0,0,0,0xcdcdcdcd,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xf3f3f3f3,0xb7b7b7b7,
+  0x2b2b2b2b,0,0,0,0,0,0,0,0x30303030,0xc6c6c6c6,0xf9f9f9f9,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfbfbfbfb,0xcdcdcdcd,
+  0x44444444,0x1010101,0,0,0,0,0,0x37373737,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0x56565656,0,0,0,0,0,0,0,0x8d8d8d8d,0xfcfcfcfc,0xfcfcfcfc,
+  0xfcfcfcfc,0xfcfcfcfc,0x2c2c2c2c,0,0,0,0,0,0x9e9e9e9e,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xe6e6e6e6,0x5050505,0,0,0,0,0,0,0x4040404,0xf1f1f1f1,
+  0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xc0c0c0c0,0,0,0,0,0,0x17171717,0xf0f0f0f0,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,
+  0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0x26262626,0,0,0,0,0xf1f1f1f1,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,
+  0xfcfcfcfc,0xfcfcfcfc,0xfcfcfcfc,0xedededed,0xa8a8a8a8,0x1c1c1c1c,0,0,0,0,0,0x32171e24,0xff739bb8,0xff739bb8,0xe06588a2,0xa040607,0x6030404,
+  0xdb63859e,0xff739bb8,0xdf6588a1,0x7040505,0x1c1b1602,0,0x1010100,0x48443905,0x7f796508,0x80796508,0x80796508,0x7f786408,0x23221c02,0,0x1e1c1702,
+  0x403d3304,0x403d3304,0x403d3304,0x2d2b2403,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x201e1902,0x403d3304,0x403d3304,
+  0x403d3304,0x1e1c1802,0,0x38352c04,0x80796508,0x80796508,0x80796508,0x79736008,0x16151101,0,0x2e2b2403,0xe7dbb70e,0xfef1c910,0x38352c04,0x8b3f5464,
+  0xff739bb8,0xff739bb8,0x431e2931,0,0x90415868,0xff739bb8,0xff739bb8,0x8d405666,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfdfdfdfd,0x72727272,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0x90909090,0x1010101,0,0,0,0,
+  0,0x6050400,0xcfc4a40d,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x43403504,0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0x928b7409,0,0,0,0,0,0,0x3a3a3a3a,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4d4d4d4d,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdededede,0x1d1d1d1d,0,0,0,0,0,0xf0f0f0f,0xe1e1e1e1,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xedededed,0x24242424,0,0,0,0,0,0x37373737,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x8b8b8b8b,0,0,0,0,0,0,0,0xc0c0c0c0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,
+  0xffffffff,0xffffffff,0xffffffff,0xf9f9f9f9,0x28282828,0,0,0,0,0,0,0x2a2a2a2a,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,
+  0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x26262626,
+  0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xcbcbcbcb,0xc0c0c0c,0,0,0,0,0x220f1518,0xff739bb8,0xff739bb8,0xeb6a8faa,0xe06080a,0x4020303,0xd25f8098,0xff739bb8,0xea698ea9,0xa050607,0xb3a98d0b,
+  0x3b382f04,0,0x3030200,0x5e594b06,0x80796508,0x80796508,0x80796508,0x69635307,0x3030200,0x5050400,0x38352c04,0x403d3304,0x403d3304,0x3d3a3004,
+  0x9080701,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0x35322a03,0x403d3304,0x403d3304,0x3c393004,0x8070600,0x4040300,
+  0x6e685707,0x80796508,0x80796508,0x80796508,0x3f3b3204,0,0x15141001,0xccc2a20d,0xfff2ca10,0xfdf0c910,0x37342b03,0x8c3f5565,0xff739bb8,0xfe739ab7,
+  0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe2e2e2e2,0x11111111,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x20202020,0,0,0,0,0,0x35322a03,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x43403504,0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xeee2bd0f,0x3030200,0,0,0,0,0,0x9d9d9d9d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4d4d4d4d,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x7b7b7b7b,0,0,0,0,0,0x63636363,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x85858585,0,0,0,0,0,0x37373737,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xbebebebe,0,0,0,0,0,0,0x9090909,0xe8e8e8e8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,
+  0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x56565656,0,0,0,0,0,0,0x5a5a5a5a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,
+  0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x57575757,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,
+  0xc8be9f0d,0xe4d9b50e,0x34322a03,0,0x15141101,0x78725f08,0x80796508,0x80796508,0x80796508,0x2d2b2303,0,0x1e1d1802,0x403d3304,0x403d3304,0x403d3304,
+  0x1e1c1702,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xc0b0a01,0x3f3b3204,0x403d3304,0x403d3304,0x2a282103,0,0x2b292203,
+  0x80796508,0x80796508,0x80796508,0x68635307,0x6050400,0x2020100,0x9a927a0a,0xfff2ca10,0xfff2ca10,0xfdf0c910,0x37342b03,0x8c3f5565,0xff739bb8,
+  0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0x47474747,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,0,0,0,
+  0,0x5d584a06,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x43403504,0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfdf0c810,0x1d1b1702,0,0,0,0,0x3030303,0xd0d0d0d0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4d4d4d4d,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcacacaca,0x1010101,0,0,0,0,0x97979797,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb9b9b9b9,
+  0,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xebebebeb,0x7070707,0,0,0,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x89898989,0,0,0,0,0,0,0x8b8b8b8b,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,
+  0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,0xc8be9f0d,0xfff2ca10,0xcfc4a40d,0x100f0d01,0,0x3a372e04,0x80796508,0x80796508,0x80796508,
+  0x69645307,0x4040300,0x8070600,0x3d393004,0x403d3304,0x403d3304,0x34312903,0x2020100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0x1f1d1802,0x403d3304,0x403d3304,0x3f3c3204,0x11100d01,0,0x635e4f06,0x80796508,0x80796508,0x80796508,0x28262003,0,0x3f3c3204,0xf9ecc510,
+  0xfff2ca10,0xfff2ca10,0xfdf0c910,0x37342b03,0x8c3f5565,0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,
+  0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x67676767,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x80808080,0,0,0,0,0,0x6f6a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0x433f3504,0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2e2c2503,0,0,0,0,0xd0d0d0d,
+  0xe3e3e3e3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x4d4d4d4d,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xe0e0e0e0,0xb0b0b0b,0,0,0,0,0xb2b2b2b2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd1d1d1d1,0x4040404,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xfafafafa,0x2c2c2c2c,0,0,0,0,0,0x54545454,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xbebebebe,0,0,0,0,0,0,0xbdbdbdbd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,
+  0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x26262626,0,0,0,0,
+  0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc7c7c7c7,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,0xc8be9f0d,0xfff2ca10,
+  0xfff2ca10,0x9991790a,0x1010100,0x6060500,0x6c665607,0x80796508,0x80796508,0x7f796508,0x27251f02,0,0x2a282203,0x403d3304,0x403d3304,0x3f3c3204,
+  0xc0c0a01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x302e2603,0x403d3304,0x403d3304,0x38352c03,0x2020200,0x14131001,0x7d776308,
+  0x80796508,0x80796508,0x6a645407,0x4040300,0x7060500,0xcbc1a10d,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xdcd1ae0e,0x15141001,0x8c3f5565,0xff739bb8,
+  0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x80808080,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x98989898,0,0,0,0,
+  0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xd8cdab0e,0xcec3a30d,0xc9bf9f0d,0x24231d02,0,0,0x56524405,0xcdc3a30d,0xcec3a30d,0xe5dab60e,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xecececec,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4d4d4d4d,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xefefefef,0x15151515,0,0,0,0,0xb7b7b7b7,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x5d5d5d5d,0,0,0,0,0,0x87878787,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe6e6e6e6,0xd0d0d0d,0,0,0,0,0x6060606,0xe9e9e9e9,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xdfdfdfdf,0x1010101,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,
+  0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,0xc8be9f0d,0xfff2ca10,0xfff2ca10,0xfef1ca10,0x423f3404,0,0x32302803,0x7f796508,
+  0x80796508,0x80796508,0x59554706,0x1010100,0x12110e01,0x403c3204,0x403d3304,0x403d3304,0x1e1d1802,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0x6050400,0x3c382f04,0x403d3304,0x403d3304,0x27251f02,0,0x3a372e04,0x80796508,0x80796508,0x80796508,0x36332b03,0,0x4d493d05,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xf5e9c20f,0x403c3204,0,0x8d3f5666,0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,
+  0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcdcdcdcd,0x53535353,0x53535353,0x54545454,0xcacacaca,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x56565656,0x53535353,0x53535353,0x9d9d9d9d,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfdf0c810,0xb0b0901,0,0,0,0,0,
+  0,0,0,0x4b483c05,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,
+  0x90909090,0x74747474,0x74747474,0x74747474,0x74747474,0x74747474,0x74747474,0x74747474,0x23232323,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x81818181,0x53535353,0x53535353,0x61616161,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,
+  0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb3b3b3b3,0x63636363,0x63636363,0x9e9e9e9e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x91919191,0,0,0,0,0,0xb8b8b8b8,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfbfbfbfb,0x2c2c2c2c,0,0,0,0,
+  0x28282828,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,
+  0xf5f5f5f5,0x64646464,0x53535353,0x53535353,0x53535353,0x53535353,0x53535353,0xc0c0c0c,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x69696969,0x53535353,0x53535353,0x6f6f6f6f,0xfcfcfcfc,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0x1c0c1114,0xff739bb8,
+  0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xee6b90ac,0xa050607,0xb4ab8f0b,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xc2b89a0c,
+  0x4040300,0x7060500,0x6d685707,0x80796508,0x80796508,0x7a746108,0x12110e01,0x2020200,0x3c392f04,0x403d3304,0x403d3304,0x2f2d2503,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x11100e01,0x403d3304,0x403d3304,0x403d3304,0x15141101,0x1010100,0x625d4e06,0x80796508,0x80796508,
+  0x746e5c07,0xb0a0901,0x1010100,0xc1b7990c,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x7c756208,0,0x5020303,0xbd557388,0xff739bb8,0xfe739ab7,0x401d272e,
+  0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x56565656,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,
+  0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf6f6f6f6,
+  0x20202020,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe1e1e1e1,0xffffffff,
+  0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4b4b4b4b,0,0,0x2d2d2d2d,0xfafafafa,
+  0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc5c5c5c5,
+  0,0,0,0,0xa0a0a0a,0xdfdfdfdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x5c5c5c5c,0,0,0,0,0x53535353,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,
+  0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,
+  0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xfb7199b5,0x31161e23,0x36332b03,0xf3e6c00f,0xfff2ca10,0xfff2ca10,0xfdf0c810,0x4e4a3d05,0,0x3f3c3204,
+  0x80796508,0x80796508,0x80796508,0x38352c03,0,0x2c2a2303,0x403d3304,0x403d3304,0x3c393004,0x4040400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0x1e1d1802,0x403d3304,0x403d3304,0x3d3a3104,0x5050400,0xf0f0c01,0x7a746108,0x80796508,0x80796508,0x524e4105,0,0x2d2b2403,0xfbeec710,
+  0xfff2ca10,0xfff2ca10,0xd9ceac0e,0xd0c0a01,0,0x48212c34,0xfb7199b5,0xff739bb8,0xfc7299b6,0x31161e23,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,
+  0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,
+  0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,
+  0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0xf0f0f0f,0,0,0,0x22222222,0xf8f8f8f8,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x8f8f8f8f,
+  0,0,0,0,0x84848484,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,
+  0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,
+  0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x2010102,0xc157758b,0xff739bb8,
+  0xff739bb8,0xae4f6a7e,0x1010100,0x80796508,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xb9b0930c,0,0x15141001,0x7d766308,0x80796508,0x80796508,0x5c584906,
+  0x1010000,0x1a181402,0x403d3304,0x403d3304,0x403d3304,0x12110e01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2b292203,0x403d3304,
+  0x403d3304,0x33302803,0,0x28251f02,0x80796508,0x80796508,0x80796508,0x2c292303,0,0x847e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x615c4d06,0,0x6030304,
+  0xc659788f,0xff739bb8,0xff739bb8,0xb8537085,0x1010101,0,0xa1486274,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,
+  0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xfcfcfcfc,0x32323232,0,0,0,0x4e4e4e4e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,
+  0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc3c3c3c3,0x1010101,0,0,0,0xb6b6b6b6,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,
+  0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,
+  0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xf56e95b1,0x170a0e11,0,0x5024313a,0xfd729ab7,0xff739bb8,0xfc7299b6,0x3b1b242b,0x12110e01,0xe0d5b20e,
+  0xfff2ca10,0xfff2ca10,0xf5e8c20f,0x25231d02,0,0x625d4e06,0x80796508,0x80796508,0x78725f08,0xa0a0801,0x8070600,0x3f3c3204,0x403d3304,0x403d3304,
+  0x1f1d1802,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020100,0x36332b03,0x403d3304,0x403d3304,0x26241e02,0,0x433f3504,0x80796508,
+  0x80796508,0x79736008,0xc0c0a01,0x4040300,0xd7ccaa0e,0xfff2ca10,0xfff2ca10,0xe2d6b30e,0x100f0d01,0,0x3f1c262e,0xfe739ab7,0xff739bb8,0xfa7198b4,
+  0x35182127,0,0x22101519,0xee6b91ac,0xff739bb8,0xff739bb8,0x7d384c5a,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,
+  0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,
+  0x5050505,0,0,0x55555555,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,
+  0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,
+  0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,
+  0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,
+  0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x63636363,0,0,0,0x7f7f7f7f,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0x10101010,0,0,0x8080808,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,
+  0,0x14090c0f,0xfd729ab7,0xff739bb8,0xff739bb8,0x7c384b59,0,0x6030304,0xbf56748a,0xff739bb8,0xff739bb8,0xb6526e83,0x1010101,0x726c5a07,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0x79726008,0,0x39362d04,0x80796508,0x80796508,0x80796508,0x25231e02,0x1010100,0x38352c04,0x403d3304,0x403d3304,0x2b282203,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4040300,0x3d393004,0x403d3304,0x403d3304,0x1b191502,0,0x5e594a06,0x80796508,0x80796508,
+  0x65605006,0,0x28262003,0xf8ebc410,0xfff2ca10,0xfff2ca10,0x928b7409,0,0,0xa74b6679,0xff739bb8,0xff739bb8,0xa84c6679,0x1010101,0x1010101,0x96445b6c,
+  0xff739bb8,0xff739bb8,0xfd729ab6,0x451f2a32,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,
+  0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,
+  0x1f1f1f1f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,
+  0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,
+  0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x97979797,0,0,0,0xb0b0b0b0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0x2f2f2f2f,0,0,0x23232323,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,
+  0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0x3010202,0xd4608199,
+  0xff739bb8,0xff739bb8,0xeb6a8faa,0x160a0e10,0,0x451f2a32,0xfa7198b4,0xff739bb8,0xf76f96b2,0x2c141b20,0x1b191502,0xefe3bd0f,0xfff2ca10,0xfff2ca10,
+  0xc6bc9d0c,0x2020200,0x19181402,0x80796508,0x80796508,0x80796508,0x3e3b3104,0,0x2e2b2403,0x403d3304,0x403d3304,0x36332b03,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb0a0801,0x403d3304,0x403d3304,0x403d3304,0xf0e0c01,0x6060500,0x726c5a07,0x80796508,0x80796508,0x4d493d05,
+  0,0x5f5b4c06,0xfff2ca10,0xfff2ca10,0xfdf0c810,0x43403504,0,0x1a0c1013,0xf76f96b2,0xff739bb8,0xfa7198b5,0x34171f25,0,0x2a131a1f,0xf36e94af,0xff739bb8,
+  0xff739bb8,0xc75a7990,0x6030404,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,
+  0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,
+  0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8c8c8c8,
+  0x2020202,0,0x8080808,0xdadadada,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x62626262,0,0,0x4b4b4b4b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0,0x632d3c48,
+  0xff739bb8,0xff739bb8,0xff739bb8,0x883e5362,0,0x4020203,0xbe567489,0xff739bb8,0xff739bb8,0x843c505f,0,0xa9a0860b,0xfff2ca10,0xfff2ca10,0xf0e3be0f,
+  0x17161201,0x3030200,0x76705e07,0x80796508,0x80796508,0x56514405,0,0x23211b02,0x403d3304,0x403d3304,0x3f3c3204,0x3020200,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x12120f01,0x403d3304,0x403d3304,0x403d3304,0x6060500,0xd0c0a01,0x7c766208,0x80796508,0x80796508,0x36332a03,
+  0,0x9b937a0a,0xfff2ca10,0xfff2ca10,0xebdfba0f,0xf0e0c01,0,0x6b30414d,0xff739bb8,0xff739bb8,0xbf56748a,0x4020203,0x1000101,0xa34a6376,0xff739bb8,
+  0xff739bb8,0xff739bb8,0x48202c34,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,
+  0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,
+  0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xecececec,
+  0x13131313,0,0x19191919,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x96969696,0,0,0x7c7c7c7c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0,0xb050608,
+  0xd25f8097,0xff739bb8,0xff739bb8,0xf06c92ad,0x1e0e1216,0,0x5828353f,0xfe739bb8,0xff739bb8,0xce5d7d95,0x4020203,0x5c584906,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0x45413604,0,0x5a564806,0x80796508,0x80796508,0x6c665507,0x2020100,0x17161201,0x403d3304,0x403d3304,0x403d3304,0xb0b0901,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x19181402,0x403d3304,0x403d3304,0x3e3b3104,0x1010100,0x18171302,0x80796508,0x80796508,0x80796508,
+  0x1f1d1802,0,0xc6bc9d0c,0xfff2ca10,0xfff2ca10,0xbdb4960c,0,0,0xaf4f6b7f,0xff739bb8,0xff739bb8,0x59283640,0,0x2f151d22,0xfc7299b6,0xff739bb8,
+  0xff739bb8,0xbb547287,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,
+  0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,
+  0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x36363636,0,0x47474747,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc9c9c9c9,0x2020202,0,0xafafafaf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,
+  0,0,0,0x5325323c,0xfd729ab6,0xff739bb8,0xff739bb8,0x8e405666,0,0xc050709,0xea698ea9,0xff739bb8,0xf87097b3,0x23101519,0x17161301,0xfaedc610,
+  0xfff2ca10,0xfff2ca10,0x807a6608,0,0x44413604,0x80796508,0x80796508,0x7e786408,0x7060500,0xd0c0a01,0x403d3304,0x403d3304,0x403d3304,0x12110f01,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1f1d1902,0x403d3304,0x403d3304,0x39362d04,0x1010100,0x27251f02,0x80796508,0x80796508,0x7f796508,
+  0x12110e01,0xb0b0901,0xe2d7b30e,0xfff2ca10,0xfff2ca10,0x8d856f09,0,0x4020203,0xe6688ca6,0xff739bb8,0xf46e94b0,0x1f0e1316,0,0x9f486173,0xff739bb8,
+  0xff739bb8,0xfa7198b4,0x3a1a232a,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x726c5a07,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,
+  0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x312f2703,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,
+  0x1f1f1f1f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,
+  0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,
+  0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x6a6a6a6a,0,0x78787878,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf4f4f4f4,0xc0c0c0c,0x8080808,0xd9d9d9d9,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,
+  0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,
+  0x1010101,0,0,0,0,0,0x7030405,0xc358768d,0xff739bb8,0xff739bb8,0xe5678ba5,0x12080b0d,0,0xa1486274,0xff739bb8,0xff739bb8,0x4e232f38,0,0xd9ceac0e,
+  0xfff2ca10,0xfff2ca10,0xa59d830a,0,0x312f2703,0x80796508,0x80796508,0x80796508,0x11100e01,0x8080601,0x403d3304,0x403d3304,0x403d3304,0x19181402,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x24221c02,0x403d3304,0x403d3304,0x33302803,0,0x35322a03,0x80796508,0x80796508,0x7f786408,
+  0x7070500,0x1c1a1602,0xf4e7c10f,0xfff2ca10,0xfff2ca10,0x68635207,0,0x1f0e1316,0xf76f96b2,0xff739bb8,0xd15e7f97,0x4020203,0xb050608,0xed6b90ab,
+  0xff739bb8,0xff739bb8,0xad4e697d,0x3010202,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0x88816c09,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,
+  0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x46433804,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,
+  0x1f1f1f1f,0,0,0,0,0,0,0,0,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,
+  0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,
+  0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x9d9d9d9d,0,0xa9a9a9a9,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x34343434,0x1a1a1a1a,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,
+  0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,
+  0x1010101,0,0,0,0,0,0,0x49212d35,0xfb7199b5,0xff739bb8,0xfe739bb8,0x4c222e37,0,0x682f3f4b,0xff739bb8,0xff739bb8,0x7e394d5b,0,0xaba2880b,0xfff2ca10,
+  0xfff2ca10,0xc5bb9c0c,0x2020100,0x1e1d1802,0x80796508,0x80796508,0x80796508,0x1c1a1602,0x5050400,0x3d3a3004,0x403d3304,0x403d3304,0x1f1d1802,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x27251f02,0x403d3304,0x403d3304,0x302d2603,0,0x3c392f04,0x80796508,0x80796508,0x7a736008,
+  0,0x25231d02,0xfdf0c810,0xfff2ca10,0xfff2ca10,0x4a463b05,0,0x3c1b242b,0xfe729ab7,0xff739bb8,0xa0486174,0,0x34171f25,0xfd729ab6,0xff739bb8,0xfe739bb8,
+  0x47202b33,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0,0xaea58a0b,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0x6c665507,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x4040404,
+  0xd0d0d0d0,0xd6d6d6d6,0xd6d6d6d6,0xd6d6d6d6,0xd6d6d6d6,0xd6d6d6d6,0xd6d6d6d6,0x9f9f9f9f,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcdcdcdcd,0x6060606,0xd8d8d8d8,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x68686868,0x44444444,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,
+  0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,
+  0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0x5020304,0xd660829a,0xff739bb8,0xff739bb8,0x873d5262,
+  0,0x36182127,0xff739bb8,0xff739bb8,0xa54b6577,0,0x847d6808,0xfff2ca10,0xfff2ca10,0xe0d5b10e,0x8070600,0x100f0d01,0x80796508,0x80796508,0x80796508,
+  0x26241e02,0x4030300,0x3a372e04,0x403d3304,0x403d3304,0x22201b02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x29272103,0x403d3304,0x403d3304,
+  0x2f2c2503,0,0x3f3b3204,0x80796508,0x80796508,0x736d5b07,0,0x34312903,0xfff2ca10,0xfff2ca10,0xfdf0c910,0x3a372e04,0,0x4e232f38,0xff739bb8,0xff739bb8,
+  0x873d5261,0,0x5727353e,0xff739bb8,0xff739bb8,0xe3668aa4,0xd06080a,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,
+  0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,
+  0x5050505,0,0,0x55555555,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0x13120f01,0xf1e5bf0f,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xc1b7990c,0x1010100,0,0,0,0x12121212,0xedededed,
+  0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x5050505,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xbdbdbdbd,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,
+  0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,
+  0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe0e0e0e0,0xffffffff,0xffffffff,0xf6f6f6f6,
+  0x1f1f1f1f,0xfcfcfcfc,0xffffffff,0xffffffff,0xdfdfdfdf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xf5f5f5f5,0xeaeaeaea,0xffffffff,0xffffffff,0x9d9d9d9d,0x75757575,0xffffffff,0xffffffff,0xe0e0e0e0,0xfefefefe,0xffffffff,
+  0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf4f4f4f4,0x58585858,0x46464646,0x46464646,
+  0x46464646,0x42424242,0x6060606,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,
+  0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0,0x863c5161,0xff739bb8,0xff739bb8,0xb6526e83,0,0x160a0e10,0xff739bb8,0xff739bb8,0xbe567489,
+  0,0x6b655507,0xfff2ca10,0xfff2ca10,0xf1e5bf0f,0xc0b0901,0xa090801,0x7f786408,0x80796508,0x80796508,0x312e2703,0x2020100,0x36342b03,0x403d3304,
+  0x403d3304,0x25241e02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2b292203,0x403d3304,0x403d3304,0x2e2b2403,0,0x423e3404,0x80796508,
+  0x80796508,0x736e5b07,0,0x3f3c3204,0xfff2ca10,0xfff2ca10,0xfcefc710,0x302e2603,0,0x602b3a45,0xff739bb8,0xff739bb8,0x70334451,0,0x672f3f4a,0xff739bb8,
+  0xff739bb8,0xc85a7a91,0,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0x756f5c07,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,
+  0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xf9ecc510,0x38362d04,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,
+  0xf5f5f5f5,0x1f1f1f1f,0x5050505,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdbdbdbd,0,0,0,0,0xcfcfcfcf,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,
+  0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xa7a7a7a7,0xffffffff,0xffffffff,0xffffffff,0x7b7b7b7b,0xffffffff,
+  0xffffffff,0xf6f6f6f6,0xaeaeaeae,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,
+  0xeaeaeaea,0xbcbcbcbc,0xffffffff,0xffffffff,0xd2d2d2d2,0xa8a8a8a8,0xffffffff,0xffffffff,0xa7a7a7a7,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,
+  0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,
+  0x16161616,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,
+  0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0,0x5f2b3a44,0xff739bb8,0xff739bb8,0xcb5c7b93,0x1000000,0x7030405,0xfd729ab7,0xff739bb8,0xcd5d7d94,0x3010202,
+  0x55514405,0xfff2ca10,0xfff2ca10,0xf7ebc410,0xd0d0b01,0x8070600,0x7a746108,0x80796508,0x80796508,0x34322a03,0x1010100,0x35332a03,0x403d3304,
+  0x403d3304,0x28262003,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2a282203,0x403d3304,0x403d3304,0x2d2a2303,0,0x45413604,0x80796508,
+  0x80796508,0x746e5c07,0,0x3a372e04,0xfff2ca10,0xfff2ca10,0xfcefc810,0x32302803,0,0x6b30414d,0xff739bb8,0xff739bb8,0x622c3c47,0,0x71334552,0xff739bb8,
+  0xff739bb8,0xb5516e82,0,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0x6050400,0xd8cdab0e,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,
+  0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x9c947b0a,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,
+  0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x5050505,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdbdbdbd,0,0,0,0,
+  0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,
+  0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x71717171,0xfdfdfdfd,0xffffffff,0xffffffff,0xdbdbdbdb,0xffffffff,
+  0xffffffff,0xd0d0d0d0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,
+  0xe9e9e9e9,0x85858585,0xffffffff,0xffffffff,0xf9f9f9f9,0xe1e1e1e1,0xffffffff,0xffffffff,0x6e6e6e6e,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,
+  0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,
+  0x16161616,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,
+  0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0,0x4b222e36,0xff739bb8,0xff739bb8,0xd660829a,0x5020303,0x4020203,0xf36e94af,0xff739bb8,0xd15e7f97,0x4020303,
+  0x504c3f05,0xfff2ca10,0xfff2ca10,0xfdf0c810,0xf0e0c01,0x6060500,0x756f5d07,0x80796508,0x80796508,0x32302803,0x1010100,0x36332b03,0x403d3304,
+  0x403d3304,0x28262002,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2a282103,0x403d3304,0x403d3304,0x2f2c2503,0,0x423f3404,0x80796508,
+  0x80796508,0x756f5d07,0,0x34312903,0xfff2ca10,0xfff2ca10,0xfdf0c910,0x39362d04,0,0x612c3b46,0xff739bb8,0xff739bb8,0x70324451,0,0x652d3d49,0xff739bb8,
+  0xff739bb8,0xc75a798f,0,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x55555555,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0x14130f01,0xeee2bc0f,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,
+  0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xbfb6980c,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,
+  0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x5050505,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdbdbdbd,0,0,0,0,
+  0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x9090909,0xe0e0e0e0,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,
+  0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x59595959,0xdddddddd,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x9c9c9c9c,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,
+  0xe9e9e9e9,0x4e4e4e4e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x35353535,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,
+  0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,
+  0x16161616,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x15151515,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,
+  0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0,0x5d2a3943,0xff739bb8,0xff739bb8,0xcc5c7c93,0x1000101,0x4020203,0xf97097b4,0xff739bb8,0xcc5c7c93,0x2010102,
+  0x504c3f05,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x12110e01,0x7060500,0x77715e07,0x80796508,0x80796508,0x312e2703,0x2020100,0x36332b03,0x403d3304,
+  0x403d3304,0x27251f02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x28262003,0x403d3304,0x403d3304,0x32302803,0,0x39372d04,0x80796508,
+  0x80796508,0x7c766308,0x1010100,0x29272103,0xfef1c910,0xfff2ca10,0xfff2ca10,0x4d493d05,0,0x4f233039,0xff739bb8,0xff739bb8,0x843c505f,0,0x5024313a,
+  0xff739bb8,0xff739bb8,0xe06588a2,0xb050608,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,
+  0,0,0x59595959,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0x5050400,0xd8cdab0e,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x9b937a0a,0,0,0,0x12121212,0xedededed,
+  0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x5050505,0xf7f7f7f7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xbdbdbdbd,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0xb0b0b0b,0xe2e2e2e2,0xffffffff,0xffffffff,0xffffffff,
+  0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,
+  0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x53535353,0xacacacac,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x64646464,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xe9e9e9e9,0x1f1f1f1f,0xf6f6f6f6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xecececec,0x10101010,0xfefefefe,0xffffffff,
+  0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x18181818,0xf9f9f9f9,0xffffffff,
+  0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0,0x813a4f5d,0xff739bb8,0xff739bb8,0xb7537084,0,0x13080b0e,0xff739bb8,0xff739bb8,0xc257768c,
+  0,0x5b564806,0xfff2ca10,0xfff2ca10,0xf6e9c30f,0xd0d0a01,0x8080701,0x7b756208,0x80796508,0x80796508,0x2f2c2503,0x2020200,0x37342b03,0x403d3304,
+  0x403d3304,0x27251f02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x24231d02,0x403d3304,0x403d3304,0x36342b03,0x1000000,0x302e2603,0x80796508,
+  0x80796508,0x7f786408,0xb0b0901,0x19181402,0xf1e4bf0f,0xfff2ca10,0xfff2ca10,0x69635307,0,0x3d1b252c,0xfe739ab7,0xff739bb8,0x9d475f71,0,0x2611171b,
+  0xfb7199b5,0xff739bb8,0xfe729ab7,0x411d282f,0,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf2f2f2f2,0xb5b5b5b5,
+  0xb4b4b4b4,0xb4b4b4b4,0xdadadada,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9b9b9b9b,0,0,0,0,0x6e695707,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xf8ebc410,0x33312903,0,0,0,0x12121212,
+  0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x2020202,0x59595959,0x8a8a8a8a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x86868686,0x44444444,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc8c8c8c8,0xb4b4b4b4,0xb4b4b4b4,0xbdbdbdbd,0xfcfcfcfc,
+  0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,
+  0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,
+  0x72727272,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfcfcfcfc,0x2d2d2d2d,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,
+  0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0x5050505,0xd6d6d6d6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbebebebe,
+  0x3030303,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x16161616,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbdbdbdbd,
+  0xb4b4b4b4,0xb4b4b4b4,0xc5c5c5c5,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xe1e1e1e1,0x1010101,0,0,0,0,0,0,0x3010202,0xd25f7f97,0xff739bb8,
+  0xff739bb8,0x8c3f5565,0,0x3a1a232a,0xff739bb8,0xff739bb8,0xa94c677a,0,0x736d5b07,0xfff2ca10,0xfff2ca10,0xe6dab60e,0x9090701,0xa0a0801,0x7f796508,
+  0x80796508,0x80796508,0x2a282103,0x3030200,0x38352c04,0x403d3304,0x403d3304,0x23211c02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x201f1a02,
+  0x403d3304,0x403d3304,0x3a372e04,0x1010100,0x27251f02,0x80796508,0x80796508,0x7f796508,0x17161201,0xa0a0801,0xe1d6b20e,0xfff2ca10,0xfff2ca10,
+  0x9992790a,0,0x1e0e1216,0xf76f96b2,0xff739bb8,0xd05e7e96,0x3010202,0x3010202,0xe3668aa4,0xff739bb8,0xff739bb8,0xa64b6578,0x2010101,0,0,0,0,
+  0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0x9c9c9c9c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,
+  0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x8e8e8e8e,0,0,0,0,0x11100e01,0xeee2bd0f,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xbdb4960c,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,
+  0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0x11111111,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x4c4c4c4c,0x9090909,0x9090909,0x30303030,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0x3a3a3a3a,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xe2e2e2e2,0xc0c0c0c,0x97979797,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0xa3a3a3a3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x86868686,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,
+  0xffffffff,0xffffffff,0xffffffff,0xfdfdfdfd,0xdbdbdbdb,0xd7d7d7d7,0xd7d7d7d7,0xd7d7d7d7,0xcacacaca,0x12121212,0,0,0,0,0,0xf3f3f3f3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd5d5d5d5,0x1010101,
+  0,0,0,0,0,0,0x421e2830,0xfb7198b5,0xff739bb8,0xff739bb8,0x4e233039,0,0x622c3c47,0xff739bb8,0xff739bb8,0x7f394d5b,0,0x8f887109,0xfff2ca10,0xfff2ca10,
+  0xd7ccaa0d,0x6050400,0x12110e01,0x80796508,0x80796508,0x80796508,0x1d1b1702,0x5040400,0x3c392f04,0x403d3304,0x403d3304,0x1f1e1902,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1b1a1502,0x403d3304,0x403d3304,0x3f3c3204,0x3030200,0x1b1a1502,0x80796508,0x80796508,0x80796508,0x26241e02,
+  0x1010100,0xc4ba9b0c,0xfff2ca10,0xfff2ca10,0xcec4a30d,0x1010100,0x3010202,0xe2668aa3,0xff739bb8,0xf16d93ae,0x1b0c1013,0,0x90415768,0xff739bb8,
+  0xff739bb8,0xf87097b3,0x34172026,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xcacacaca,0x4a4a4a4a,0x4a4a4a4a,0x4b4b4b4b,
+  0xc6c6c6c6,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x83838383,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x74747474,0,0,0,0,0,0xada4890b,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x6b655507,0,0,0,0,0x12121212,0xedededed,
+  0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd9d9d9d9,
+  0x7070707,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd6d6d6d6,0xc6c6c6c6,0xc6c6c6c6,0xcfcfcfcf,0xfefefefe,0xffffffff,
+  0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0x14141414,0xedededed,
+  0xffffffff,0xffffffff,0xffffffff,0xb6b6b6b6,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,
+  0xffffffff,0xffffffff,0xe9e9e9e9,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4e4e4e4e,0x2020202,0xfefefefe,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x1e1e1e1e,0x5050505,0x5050505,0x5050505,
+  0x5050505,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xbbbbbbbb,0,0,0,0,0,0,0x5020304,0xbc557288,0xff739bb8,0xff739bb8,0xe8698da7,0x15090d0f,0,0xa0486173,0xff739bb8,0xff739bb8,
+  0x4a212d35,0,0xbfb5970c,0xfff2ca10,0xfff2ca10,0xbfb5970c,0x1010100,0x23211c02,0x80796508,0x80796508,0x80796508,0xf0e0c01,0x8070600,0x403c3204,
+  0x403d3304,0x403d3304,0x1b1a1602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x14131001,0x403d3304,0x403d3304,0x403d3304,0xb0b0901,0xc0c0a01,
+  0x7a746108,0x80796508,0x80796508,0x3d3a3004,0,0x90897209,0xfff2ca10,0xfff2ca10,0xefe3be0f,0x17161201,0,0xb4516d82,0xff739bb8,0xff739bb8,0x5426333c,
+  0,0x30161d22,0xfc7299b6,0xff739bb8,0xff739bb8,0xb3516d81,0,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x7d7d7d7d,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfdfdfdfd,0x39393939,0,0,0,0,0,0x87806b08,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x46423704,0,0,
+  0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xa2a2a2a2,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,
+  0x2020202,0xc7c7c7c7,0xffffffff,0xffffffff,0xffffffff,0x7e7e7e7e,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,
+  0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0x36363636,0xfcfcfcfc,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0x2020202,0xfefefefe,
+  0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,
+  0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x7e7e7e7e,0,0,0,0,0,0,0x4c222e37,0xfb7199b5,0xff739bb8,0xff739bb8,0x94435a6b,0,0x9040506,0xe6688ca6,0xff739bb8,0xf56e95b1,0x1f0e1317,
+  0x4040300,0xeee2bd0f,0xfff2ca10,0xfff2ca10,0x928b7409,0,0x36332b03,0x80796508,0x80796508,0x7c766308,0x4040300,0xe0d0b01,0x403d3304,0x403d3304,
+  0x403d3304,0x14131001,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xd0c0a01,0x403d3304,0x403d3304,0x403d3304,0x15141001,0x4040300,0x6e685707,
+  0x80796508,0x80796508,0x56514405,0,0x5b564806,0xfff2ca10,0xfff2ca10,0xfef1ca10,0x58544606,0,0x74344654,0xff739bb8,0xff739bb8,0xb2506c80,0x1010101,
+  0x2010101,0xaf4f6a7e,0xff739bb8,0xff739bb8,0xfd729ab6,0x3d1b252c,0,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x63636363,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xc5c5c5c5,0x8080808,0,0,0,0,
+  0,0x716c5a07,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x312e2703,
+  0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xf8f8f8f8,0x3f3f3f3f,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,
+  0,0x91919191,0xffffffff,0xffffffff,0xfefefefe,0x46464646,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,
+  0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0xf0f0f0f,0xebebebeb,0xffffffff,0xffffffff,0xd6d6d6d6,0x5050505,0x2020202,0xfefefefe,0xffffffff,
+  0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,
+  0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,
+  0x23232323,0,0,0,0,0,0x7030405,0xc85a7a90,0xff739bb8,0xff739bb8,0xf56f95b1,0x2611171b,0,0x46202b33,0xfd729ab7,0xff739bb8,0xd661829b,0x6030304,
+  0x32302803,0xfdf0c910,0xfff2ca10,0xfff2ca10,0x635e4e06,0,0x49463a05,0x80796508,0x80796508,0x706a5907,0x2020200,0x14131001,0x403d3304,0x403d3304,
+  0x403d3304,0xd0d0a01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x6050400,0x3e3b3104,0x403d3304,0x403d3304,0x1e1d1802,0,0x5c574906,
+  0x80796508,0x80796508,0x6e695707,0x1010100,0x1f1e1902,0xf4e7c10f,0xfff2ca10,0xfff2ca10,0xb5ac8f0b,0x1010100,0x200f1417,0xfc7299b6,0xff739bb8,
+  0xf76f96b2,0x2b131a1f,0,0x2f151d22,0xf66f96b2,0xff739bb8,0xff739bb8,0xc257768c,0x4020203,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0x41414141,0,0,0,0,0x3b3b3b3b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd8d8d8d8,0x2a2a2a2a,
+  0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,
+  0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xf9f9f9f9,0x74747474,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,
+  0,0x57575757,0xffffffff,0xffffffff,0xf2f2f2f2,0x17171717,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,
+  0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0xc0c0c0c0,0xffffffff,0xffffffff,0xa0a0a0a0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,
+  0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x58585858,0,0,0,0,0,0,0x5b293742,
+  0xff739bb8,0xff739bb8,0xff739bb8,0x90415868,0,0x2010102,0xb6526f83,0xff739bb8,0xff739bb8,0x823b4f5e,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfdf1c910,
+  0x322f2703,0,0x66615106,0x80796508,0x80796508,0x59554706,0,0x1e1d1802,0x403d3304,0x403d3304,0x403d3304,0x5050400,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0x2020200,0x37342b03,0x403d3304,0x403d3304,0x2b292203,0,0x44413604,0x80796508,0x80796508,0x7c766308,0x15141101,0x1010100,
+  0xc5bb9c0c,0xfff2ca10,0xfff2ca10,0xf2e6c00f,0x23211c02,0,0xbf56748a,0xff739bb8,0xff739bb8,0xa1496274,0x1010101,0x2010101,0x9e476072,0xff739bb8,
+  0xff739bb8,0xfc7299b6,0x411d272f,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd8d8d8d8,0xb0b0b0b,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xe3e3e3e3,
+  0x61616161,0x9d9d9d9d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x71717171,0,0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,
+  0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,
+  0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x88888888,0x60606060,0xf8f8f8f8,0xffffffff,0xffffffff,0xffffffff,0xdcdcdcdc,0,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,
+  0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0x27272727,0xf8f8f8f8,0xffffffff,0xd0d0d0d0,0,0,0x97979797,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0x88888888,0xffffffff,0xffffffff,0x68686868,
+  0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,
+  0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x72727272,0x73737373,0xfdfdfdfd,0xffffffff,0xffffffff,
+  0xffffffff,0xb8b8b8b8,0,0,0,0,0,0,0x3010202,0xd05e7e96,0xff739bb8,0xff739bb8,0xef6c91ad,0x1a0c1013,0,0x3e1c262d,0xf97097b3,0xff739bb8,0xf46e94b0,
+  0x2511161a,0x5050400,0xd4c9a80d,0xfff2ca10,0xfff2ca10,0xddd2af0e,0xb0b0901,0x8070600,0x7d776308,0x80796508,0x80796508,0x3f3b3204,0,0x2b292203,
+  0x403d3304,0x403d3304,0x3b382f04,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2d2b2403,0x403d3304,0x403d3304,0x39362d04,0x1010100,
+  0x23221c02,0x7f796508,0x80796508,0x80796508,0x37342c03,0,0x746e5c07,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x918a7309,0x1010100,0x5024313a,0xfe739bb8,
+  0xff739bb8,0xf87097b3,0x30161d22,0,0x2812181d,0xf06c92ad,0xff739bb8,0xff739bb8,0x7a374a58,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf6f6f6f6,0x5b5b5b5b,0,0,0,0,0,0x3b3b3b3b,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0x49494949,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x95959595,0,0,0,0,0,0,0,0x706a5807,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,
+  0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0x2020202,0xdadadada,0xffffffff,0xffffffff,0xffffffff,
+  0xf3f3f3f3,0xc0c0c0c,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0x7070707,
+  0xdfdfdfdf,0xffffffff,0x98989898,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,
+  0xffffffff,0xe9e9e9e9,0,0,0x51515151,0xffffffff,0xfbfbfbfb,0x33333333,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,
+  0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x20202020,0x14141414,0xecececec,0xffffffff,0xffffffff,0xffffffff,0xd7d7d7d7,0x5050505,0,0,0,0,0,0x13080b0d,0xfc7299b6,0xff739bb8,
+  0xff739bb8,0x833b505f,0,0x5020304,0xb9537085,0xff739bb8,0xff739bb8,0xae4f6a7e,0x1000000,0x47443804,0xfbefc710,0xfff2ca10,0xfff2ca10,0x9a927a0a,
+  0,0x25231d02,0x80796508,0x80796508,0x80796508,0x24221d02,0x1010100,0x36342b03,0x403d3304,0x403d3304,0x302e2603,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0x211f1a02,0x403d3304,0x403d3304,0x3f3b3204,0xa090801,0xa090801,0x77705e07,0x80796508,0x80796508,0x5d584a06,0,0x1a181402,
+  0xf5e9c20f,0xfff2ca10,0xfff2ca10,0xf3e7c10f,0x26241e02,0x8040506,0xce5d7d95,0xff739bb8,0xff739bb8,0xaf4f6a7e,0,0x1000001,0xa64b6578,0xff739bb8,
+  0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0xd1d1d1d1,0xd1d1d1d1,0xd1d1d1d1,0xd1d1d1d1,
+  0xcfcfcfcf,0xa9a9a9a9,0x4e4e4e4e,0x2020202,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0x24242424,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xbbbbbbbb,0,0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,
+  0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,
+  0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x44444444,0,0xb8b8b8b8,0xffffffff,0xffffffff,0xffffffff,0xfbfbfbfb,0x2c2c2c2c,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x76767676,0x42424242,0x42424242,0x60606060,0xfafafafa,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0xafafafaf,0xffffffff,0x5f5f5f5f,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0x1e1e1e1e,0xfafafafa,0xe9e9e9e9,0xc0c0c0c,0,0x2020202,
+  0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,
+  0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0x5050505,0xd7d7d7d7,0xffffffff,0xffffffff,0xffffffff,
+  0xedededed,0x15151515,0,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xf66f95b1,0x1b0c1114,0,0x48212c34,0xfb7199b5,0xff739bb8,0xfe729ab7,0x421e282f,
+  0x3030200,0xb7ae910c,0xfff2ca10,0xfff2ca10,0xfef1c910,0x4b483c05,0,0x4d493d05,0x80796508,0x80796508,0x7c766208,0xd0d0a01,0x5050400,0x3f3c3204,
+  0x403d3304,0x403d3304,0x25231d02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x12110e01,0x403d3304,0x403d3304,0x403d3304,0x18171302,
+  0,0x5d584906,0x80796508,0x80796508,0x7a736008,0x11100e01,0,0xa59c820a,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xb1a88c0b,0x3030200,0x5125323b,0xfd729ab7,
+  0xff739bb8,0xfa7198b5,0x2e151c21,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xb6b6b6b6,0x7070707,0x7070707,0x7070707,0x7070707,0x7070707,0x2020202,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xd3d3d3d3,0x5050505,0xe0e0e0e,0xf0f0f0f0,0xffffffff,0xffffffff,0xffffffff,0xe0e0e0e0,0x3030303,0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,
+  0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0x93939393,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x4f4f4f4f,0,0,0,0,0,0,0xb7b7b7b7,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,
+  0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0x19191919,0x2c2c2c2c,0xb0b0b0b,0,0,0x97979797,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0x1010101,0x2a2a2a2a,0x25252525,0,0,0x2020202,
+  0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,
+  0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,
+  0x2c2c2c2c,0,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x2010101,0xbc557287,0xff739bb8,0xff739bb8,0xb8537085,0x1010101,
+  0x48443905,0xfaedc610,0xfff2ca10,0xfff2ca10,0xddd2af0e,0xc0c0a01,0x5050400,0x746e5c07,0x80796508,0x80796508,0x645f4f06,0x2020200,0x13120f01,
+  0x403d3304,0x403d3304,0x403d3304,0x17161201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x6060500,0x3c393004,0x403d3304,0x403d3304,
+  0x2c2a2303,0,0x37342b03,0x80796508,0x80796508,0x80796508,0x423e3404,0,0x2f2d2503,0xf8ecc510,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x736e5b07,0x6030404,
+  0xc358768c,0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0x5050505,0xd4d4d4d4,
+  0xffffffff,0xffffffff,0xffffffff,0xf1f1f1f1,0x19191919,0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,
+  0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,
+  0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x44444444,0,0x6e6e6e6e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x76767676,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,
+  0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,
+  0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0x92929292,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,
+  0xff739bb8,0xfc7299b6,0x36192127,0x12110e01,0xd7ccaa0d,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x76705d07,0,0x29272003,0x7f796508,0x80796508,0x80796508,
+  0x3c393004,0,0x26241e02,0x403d3304,0x403d3304,0x3f3c3204,0x8080701,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010000,0x312f2703,
+  0x403d3304,0x403d3304,0x3b382f04,0x5050400,0xe0d0b01,0x7a746008,0x80796508,0x80796508,0x706a5907,0x7070600,0x1010100,0xa1997f0a,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xf2e6c00f,0x24221d02,0x8d3f5565,0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,
+  0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xd3d3d3d3,0x5050505,0,0xb5b5b5b5,0xffffffff,0xffffffff,0xffffffff,0xfdfdfdfd,0x34343434,0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,
+  0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0x4a4a4a4a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9c9c9c9c,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,
+  0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,
+  0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x20202020,0,0x6e6e6e6e,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x79797979,0,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,
+  0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xee6b90ab,0xa050607,0x8c856f09,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xeadeb90f,0x16151201,
+  0x2020100,0x5e594a06,0x80796508,0x80796508,0x7d766308,0x17161201,0x1010100,0x38352d04,0x403d3304,0x403d3304,0x37342b03,0x2020100,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1f1d1802,0x403d3304,0x403d3304,0x403d3304,0x16151101,0,0x58534505,0x80796508,0x80796508,0x80796508,
+  0x35322a03,0,0x25231d02,0xe9deb90f,0xfff2ca10,0xfff2ca10,0xfdf0c910,0x37342b03,0x8c3f5565,0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,
+  0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0x91919191,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x58585858,0,0,0,0,0,0,0x706a5807,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,
+  0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0x26262626,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xc3c3c3c3,0,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,
+  0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,
+  0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,0,0,0,0,0,0,0,0,0,0,
+  0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0x4a4a4a4a,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x9f9f9f9f,0,0,0,
+  0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,0xc8be9f0d,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0x716c5a07,0,0x1c1a1602,0x7d766308,0x80796508,0x80796508,0x68635307,0x3030200,0xd0c0a01,0x3f3c3204,0x403d3304,0x403d3304,0x26241e02,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xd0c0a01,0x3f3c3204,0x403d3304,0x403d3304,0x2c2a2303,0,0x23211c02,0x80796508,0x80796508,
+  0x80796508,0x736d5b07,0x9080701,0,0x68625207,0xfef1c910,0xfff2ca10,0xfdf0c910,0x37342b03,0x8c3f5565,0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,
+  0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0x6c6c6c6c,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x7f7f7f7f,0,0,0,
+  0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfbeec710,0x2020200,0,0,0,0,0,0,0,0,0x403d3304,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,
+  0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,0xffffffff,0xffffffff,0xf5f5f5f5,0x1f1f1f1f,0,0,0x48484848,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x42424242,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0x10101010,0xf0f0f0f0,0xffffffff,0xffffffff,
+  0xffffffff,0xe3e3e3e3,0x7070707,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,
+  0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,
+  0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf0f0f0f0,0x19191919,
+  0,0,0,0,0,0,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0x2b2b2b2b,0xfafafafa,0xffffffff,0xffffffff,0xffffffff,
+  0xc4c4c4c4,0x2020202,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,0xc8be9f0d,
+  0xfff2ca10,0xfff2ca10,0xd1c6a60d,0x9080701,0x1010100,0x57534505,0x80796508,0x80796508,0x80796508,0x39362d04,0,0x211f1a02,0x403d3304,0x403d3304,
+  0x403d3304,0x13120f01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1000000,0x33302803,0x403d3304,0x403d3304,0x3e3b3104,0xb0a0801,
+  0x1010100,0x645f4f06,0x80796508,0x80796508,0x80796508,0x48443905,0x1010000,0x4040300,0xa39a810a,0xfef1ca10,0xfdf0c910,0x37342b03,0x8c3f5565,
+  0xff739bb8,0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0x47474747,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xa7a7a7a7,0,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfdf0c810,0x17161201,0xd0c0a01,0xc0b0901,0x1010100,
+  0,0,0x4030300,0xd0c0a01,0xd0c0a01,0x55504305,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xedededed,0xffffffff,
+  0xffffffff,0xffffffff,0xfefefefe,0x86868686,0x68686868,0x68686868,0xa2a2a2a2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,
+  0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0x6060606,0xd4d4d4d4,0xffffffff,0xffffffff,0xffffffff,0xf4f4f4f4,0x1e1e1e1e,
+  0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xf4f4f4f4,0x59595959,0x47474747,0x47474747,0x47474747,
+  0x47474747,0x47474747,0xb0b0b0b,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0x11111111,0xedededed,0xffffffff,
+  0xffffffff,0xffffffff,0xe3e3e3e3,0xa0a0a0a,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,
+  0xb050707,0xc8be9f0d,0xfff2ca10,0xf0e4be0f,0x34312903,0,0x25231e02,0x7f786408,0x80796508,0x80796508,0x756f5d07,0xa090801,0x3030200,0x38352d04,
+  0x403d3304,0x403d3304,0x3a372e04,0x5040400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1a191502,0x403d3304,0x403d3304,0x403d3304,
+  0x24231d02,0,0x28262003,0x7f786408,0x80796508,0x80796508,0x7d776308,0x25231d02,0,0xe0d0b01,0xc0b6980c,0xfdf0c910,0x37342b03,0x8c3f5565,0xff739bb8,
+  0xfe739ab7,0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0x25252525,0xfcfcfcfc,0xffffffff,0xffffffff,
+  0xffffffff,0xcccccccc,0x1010101,0,0,0,0,0,0x706a5807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xe4d9b50e,0xd9ceac0e,0xd6cba90d,0x2a272103,
+  0,0,0x5f5a4b06,0xd9ceac0e,0xd9ceac0e,0xeee2bd0f,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2f2c2503,0,0,0,0,0x12121212,0xecececec,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x41414141,0,0,0,0,
+  0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0xb6b6b6b6,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0x3a3a3a3a,0,
+  0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0x1010101,0xd9d9d9d9,0xffffffff,
+  0xffffffff,0xffffffff,0xfcfcfcfc,0x19191919,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,
+  0xb050707,0xc8be9f0d,0xfaedc610,0x635e4e06,0,0x7070600,0x69635307,0x80796508,0x80796508,0x80796508,0x45423704,0,0x17161201,0x403d3304,0x403d3304,
+  0x403d3304,0x27251f02,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x5040400,0x3d393004,0x403d3304,0x403d3304,0x3b382f04,0x6060500,
+  0x3030200,0x5e594a06,0x80796508,0x80796508,0x80796508,0x706b5907,0x11100d01,0,0x18171301,0xbbb2950c,0x37342b03,0x8c3f5565,0xff739bb8,0xfe739ab7,
+  0x401d272e,0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0x13131313,0xeaeaeaea,0xffffffff,0xffffffff,
+  0xffffffff,0xe5e5e5e5,0xf0f0f0f,0,0,0,0,0,0x6f695807,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x43403504,
+  0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x2e2c2403,0,0,0,0,0xd0d0d0d,0xe3e3e3e3,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfdfdfdfd,0x36363636,0,0,0,0,
+  0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x91919191,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x60606060,0,
+  0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0xb6b6b6b6,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x3c3c3c3c,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xb050707,
+  0xc4ba9b0c,0x7c766208,0x4040300,0,0x49463a05,0x80796508,0x80796508,0x80796508,0x7a746108,0x10100d01,0x1010100,0x312e2703,0x403d3304,0x403d3304,
+  0x3f3c3204,0x100f0c01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x28262003,0x403d3304,0x403d3304,0x403d3304,0x22211b02,
+  0,0x1b1a1502,0x7b756208,0x80796508,0x80796508,0x80796508,0x635e4e06,0xb0b0901,0,0x12110e01,0x12110e01,0x8c3f5565,0xff739bb8,0xfe739ab7,0x401d272e,
+  0,0x94435a6b,0xff739bb8,0xff739bb8,0x863d5261,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0x3030303,0xd5d5d5d5,0xffffffff,0xffffffff,0xffffffff,0xf9f9f9f9,
+  0x21212121,0,0,0,0,0,0x5a564806,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x43403504,0,0,0x857e6908,0xfff2ca10,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfdf0c810,0x1a191502,0,0,0,0,0x3030303,0xd0d0d0d0,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xf6f6f6f6,0x1e1e1e1e,0,0,0,0,0,0xcfcfcfcf,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x6d6d6d6d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x87878787,0,0,0,0,0,0xb7b7b7b7,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,
+  0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,
+  0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x91919191,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0x62626262,0,0,0,0,0x1c0c1114,0xff739bb8,0xff739bb8,0xef6c92ad,0xf07090b,0x4020203,0xcf5e7e96,0xff739bb8,0xed6b90ab,0xa050707,0x4c483c05,0x4040300,
+  0,0x2a282103,0x7d776308,0x80796508,0x80796508,0x80796508,0x423f3404,0,0x100f0c01,0x3f3c3204,0x403d3304,0x403d3304,0x35322a03,0x2010100,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xc0b0901,0x3f3b3204,0x403d3304,0x403d3304,0x3d3a3104,0x8080701,0x1010000,0x44403604,
+  0x80796508,0x80796508,0x80796508,0x80796508,0x615c4d06,0x8080701,0,0,0x873d5262,0xff739bb8,0xff739bb8,0x441f2931,0,0x8f415767,0xff739bb8,0xff739bb8,
+  0x893e5363,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0xb4b4b4b4,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x42424242,0,0,0,0,0,0x312e2703,0xfef2ca10,
+  0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x43403504,0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0xece0bb0f,0x2020100,0,0,0,0,0,0x9d9d9d9d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xd8d8d8d8,0x5050505,0,0,0,0,0,0xcfcfcfcf,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x48484848,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xaeaeaeae,0,0,0,0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,
+  0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,
+  0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,
+  0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x20202020,0,0,0x6d6d6d6d,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x89898989,0,0,0,0,0x220f1518,0xff739bb8,0xff739bb8,0xed6b90ab,
+  0xe06090a,0x4020303,0xd35f8098,0xff739bb8,0xec6b90aa,0x9040607,0,0,0x1f1e1902,0x78725f08,0x80796508,0x80796508,0x80796508,0x6d675607,0x7070600,
+  0x1010100,0x2f2d2503,0x403d3304,0x403d3304,0x403d3304,0x1c1b1602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x28262003,
+  0x403d3304,0x403d3304,0x403d3304,0x2d2a2303,0x1010100,0x5040400,0x625d4e06,0x80796508,0x80796508,0x80796508,0x80796508,0x69645307,0x16151201,
+  0,0x79364957,0xff739bb8,0xff739bb8,0x5124313a,0,0x823b4f5e,0xff739bb8,0xff739bb8,0x9e476072,0,0,0,0,0x6b6b6b6b,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xb4b4b4b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3b3b3b3b,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xd3d3d3d3,0x5050505,0,0,0x8e8e8e8e,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x6a6a6a6a,0,0,0,0,0,0x2020200,0xc2b89a0c,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,
+  0xfff2ca10,0x43403504,0,0,0x857e6908,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0x837c6808,0,0,0,0,0,0,0x35353535,0xf6f6f6f6,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfefefefe,0x6a6a6a6a,0,0,0,0,0,0,0xcfcfcfcf,
+  0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x44444444,0,0,0x27272727,0xfbfbfbfb,0xffffffff,0xffffffff,0xffffffff,0xd2d2d2d2,0x3030303,0,0,
+  0,0,0xb7b7b7b7,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x46464646,0,0,0x29292929,0xf9f9f9f9,0xffffffff,0xffffffff,0xffffffff,0xd4d4d4d4,
+  0x5050505,0,0,0,0,0x37373737,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x52525252,0,0,0,0,0,0,0,0x97979797,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0x2c2c2c2c,0,0,0,0,0,0xa0a0a0a0,0xffffffff,0xffffffff,0xffffffff,0xe9e9e9e9,0,0,0,0,0,0,0,0x2020202,0xfefefefe,0xffffffff,0xffffffff,
+  0xffffffff,0xc2c2c2c2,0,0,0,0,0,0x17171717,0xf2f2f2f2,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xffffffff,0xffffffff,0x26262626,0,0,0,0,0xf3f3f3f3,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x20202020,0,0,0x47474747,0xfefefefe,0xffffffff,
+  0xffffffff,0xffffffff,0xb1b1b1b1,0,0,0,0,0x35182127,0xff739bb8,0xff739bb8,0xe3678aa4,0xb050708,0x7030405,0xdd6486a0,0xff739bb8,0xe6688ca6,0x8040506,
+  0,0x1f1d1802,0x756f5d07,0x80796508,0x80796508,0x80796508,0x7e776408,0x26241e02,0,0x15141101,0x403d3304,0x403d3304,0x403d3304,0x39362d04,0x3030200,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xa0a0801,0x3d3a3004,0x403d3304,0x403d3304,0x3f3c3204,0x18171302,0,0x14131001,
+  0x726d5b07,0x80796508,0x80796508,0x80796508,0x80796508,0x756f5c07,0x18171302,0x6a30404c,0xff739bb8,0xff739bb8,0x5e2b3944,0,0x73344653,0xff739bb8,
+  0xff739bb8,0xb7536f84,0,0,0,0,0x61616161,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xa5a5a5a5,0,0,0,0,0,0,0,0,0,0,0,0,0,0x36363636,0xe9e9e9e9,
+  0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xc1c1c1c1,0x4040404,0,0,0x63636363,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0x82828282,0,0,0,0,0,0,0x2e2b2403,
+  0xd3c8a70d,0xfcefc810,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfef1c910,0x3c393004,0,0,0x7d776308,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xfff2ca10,0xf8ebc410,
+  0xb2a98d0b,0x11100e01,0,0,0,0,0,0,0x1010101,0x6b6b6b6b,0xebebebeb,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
+  0xf3f3f3f3,0x97979797,0x7070707,0,0,0,0,0,0,0xbdbdbdbd,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0x3e3e3e3e,0,0,0x12121212,0xd7d7d7d7,0xe9e9e9e9,
+  0xe9e9e9e9,0xe9e9e9e9,0xd5d5d5d5,0xf0f0f0f,0,0,0,0,0xa7a7a7a7,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0x40404040,0,0,0x25252525,0xe3e3e3e3,
+  0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xc2c2c2c2,0x5050505,0,0,0,0,0x32323232,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0x4b4b4b4b,0,0,0,0,0,0,
+  0,0x8a8a8a8a,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0x28282828,0,0,0,0,0,0x92929292,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xd5d5d5d5,0,0,0,
+  0,0,0,0,0x1010101,0xe8e8e8e8,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xb1b1b1b1,0,0,0,0,0,0x15151515,0xdddddddd,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,
+  0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0x23232323,0,0,0,0,0xdededede,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,
+  0x1d1d1d1d,0,0,0x25252525,0xe6e6e6e6,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xc2c2c2c2,0x1010101,0,0,0,0x4c222e37,0xff739bb8,0xff739bb8,0xd660829a,
+  0x6030404,0x9040607,0xe9698ea8,0xff739bb8,0xd661829b,0x5020304,0x2c292303,0x77715e07,0x80796508,0x80796508,0x80796508,0x7f796508,0x4a463a05,
+  0x2020100,0x5050400,0x38352c04,0x403d3304,0x403d3304,0x403d3304,0x1c1b1602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0x25231e02,0x403d3304,0x403d3304,0x403d3304,0x3a372e04,0xb0b0901,0,0x201f1902,0x79726008,0x80796508,0x80796508,0x80796508,0x80796508,
+  0x312f2703,0x5b293742,0xff739bb8,0xff739bb8,0x75354755,0,0x5225323b,0xff739bb8,0xff739bb8,0xda62859d,0x6030404,0,0,0,0xf0f0f0f,0x24242424,0x24242424,
+  0x24242424,0x24242424,0x19191919,0,0,0,0,0,0,0,0,0,0,0,0,0,0x8080808,0x24242424,0x24242424,0x24242424,0x24242424,0x1e1e1e1e,0x1010101,0,0,0xd0d0d0d,
+  0x24242424,0x24242424,0x24242424,0x24242424,0x17171717,0,0,0,0,0,0,0,0x17151201,0x423f3504,0x4e4a3e05,0x4e4a3e05,0x4e4a3e05,0x4b473b05,0xa090801,
+  0,0,0x1b191502,0x4e4a3e05,0x4e4a3e05,0x4e4a3e05,0x4e4a3e05,0x39362d04,0xc0b0a01,0,0,0,0,0,0,0,0,0x1010101,0x27272727,0x53535353,0x61616161,
+  0x61616161,0x61616161,0x61616161,0x61616161,0x5a5a5a5a,0x31313131,0x6060606,0,0,0,0,0,0,0,0x1d1d1d1d,0x24242424,0x24242424,0x24242424,0x24242424,
+  0xa0a0a0a,0,0,0x2020202,0x20202020,0x24242424,0x24242424,0x24242424,0x22222222,0x3030303,0,0,0,0,0x1a1a1a1a,0x24242424,0x24242424,0x24242424,
+  0x24242424,0xa0a0a0a,0,0,0x6060606,0x23232323,0x24242424,0x24242424,0x24242424,0x1e1e1e1e,0x1010101,0,0,0,0,0x8080808,0x24242424,0x24242424,
+  0x24242424,0x24242424,0xc0c0c0c,0,0,0,0,0,0,0,0x15151515,0x24242424,0x24242424,0x24242424,0x24242424,0x6060606,0,0,0,0,0,0x17171717,0x24242424,
+  0x24242424,0x24242424,0x21212121,0,0,0,0,0,0,0,0,0x24242424,0x24242424,0x24242424,0x24242424,0x1b1b1b1b,0,0,0,0,0,0x3030303,0x22222222,0x24242424,
+  0x24242424,0x24242424,0x24242424,0x24242424,0x24242424,0x24242424,0x24242424,0x24242424,0x24242424,0x5050505,0,0,0,0,0x22222222,0x24242424,
+  0x24242424,0x24242424,0x24242424,0x5050505,0,0,0x4040404,0x23232323,0x24242424,0x24242424,0x24242424,0x21212121,0,0,0,0,0x7c384b59,0xff739bb8,
+  0xff739bb8,0xbb547187,0,0x13080b0e,0xfb7199b5,0xff739bb8,0xc659788f,0x4030301,0x77715e07,0x80796508,0x80796508,0x80796508,0x80796508,0x5f5a4b06,
+  0x7060500,0,0x26241e02,0x403d3304,0x403d3304,0x403d3304,0x39362d04,0x4040300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0x6060500,0x38352c04,0x403d3304,0x403d3304,0x403d3304,0x33302803,0x4040300,0,0x28262003,0x79736008,0x80796508,0x80796508,0x80796508,
+  0x3e3b3104,0x431e2931,0xff739bb8,0xff739bb8,0x9c465f70,0,0x2f151d22,0xfb7198b5,0xff739bb8,0xf77096b3,0x2611171b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb3516d81,0xff739bb8,0xff739bb8,0x94435a6b,
+  0,0x32161e24,0xff739bb8,0xff739bb8,0xae4e6a7d,0xa0a0801,0x80796508,0x80796508,0x80796508,0x80796508,0x6a645407,0xf0e0c01,0,0x17161201,0x3f3b3204,
+  0x403d3304,0x403d3304,0x403d3304,0x18171302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x13120f01,0x3f3c3204,
+  0x403d3304,0x403d3304,0x403d3304,0x2d2b2403,0x2020200,0,0x21201a02,0x756f5d07,0x80796508,0x80796508,0x4d493d05,0x210f1418,0xf56f95b1,0xff739bb8,
+  0xc458778d,0,0xc050709,0xec6b90ab,0xff739bb8,0xff739bb8,0x662e3e49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x12080b0d,0xf06c92ad,0xff739bb8,0xff739bb8,0x5d2a3843,0,0x5c2a3843,0xff739bb8,0xff739bb8,
+  0x843c5060,0x1a181402,0x80796508,0x80796508,0x80796508,0x6a645407,0xe0d0b01,0,0xd0d0a01,0x3c392f04,0x403d3304,0x403d3304,0x403d3304,0x2e2b2403,
+  0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x26241e02,0x403d3304,0x403d3304,0x403d3304,0x403d3304,
+  0x29272103,0x3030200,0,0x15141001,0x625d4e06,0x80796508,0x635e4e06,0x6030404,0xe4678ba4,0xff739bb8,0xe9698ea8,0xe06080a,0,0xb5526e83,0xff739bb8,
+  0xff739bb8,0xc659788f,0x5020304,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0x632d3c47,0xff739bb8,0xff739bb8,0xf77096b2,0x2611171b,0,0x96445b6c,0xff739bb8,0xff739bb8,0x5b293742,0x2e2c2503,0x80796508,
+  0x7f796508,0x5c574906,0xd0d0b01,0,0xa0a0801,0x38352d04,0x403d3304,0x403d3304,0x403d3304,0x3c392f04,0xb0a0901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4040400,0x33312803,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x2c292303,0x5050400,0,0x7070600,
+  0x413e3304,0x69635307,0x7070600,0xbd557389,0xff739bb8,0xfd729ab6,0x3d1c252c,0,0x6f324350,0xff739bb8,0xff739bb8,0xfb7199b5,0x3f1c262d,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x9040607,0xcb5c7c93,
+  0xff739bb8,0xff739bb8,0xcb5b7b92,0x4020303,0,0xd15e7f97,0xff739bb8,0xfc7199b5,0x2b131a1f,0x48453905,0x7a736008,0x44403604,0x6050500,0,0xa0a0801,
+  0x36332a03,0x403d3304,0x403d3304,0x403d3304,0x3f3c3204,0x1c1a1602,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0x9090701,0x38352c03,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x322f2703,0xc0b0901,0,0,0x12110f01,0x5050400,0x853c5160,0xff739bb8,
+  0xff739bb8,0x7e394d5b,0,0x1a0c1012,0xf87097b3,0xff739bb8,0xff739bb8,0xc559788e,0x6030405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x612c3b46,0xfd729ab7,0xff739bb8,0xff739bb8,0x78364957,0,0x220f1519,
+  0xfb7199b5,0xff739bb8,0xdd6486a0,0xa050607,0x423e3404,0x1d1b1702,0x1010100,0,0xd0d0b01,0x38352c03,0x403d3304,0x403d3304,0x403d3304,0x403d3304,
+  0x28262003,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xe0d0b01,0x3c393004,0x403d3304,
+  0x403d3304,0x403d3304,0x403d3304,0x3b382f04,0x1a191502,0x1010100,0,0,0x3c1b242b,0xfd729ab7,0xff739bb8,0xcd5c7d94,0x6030404,0,0xaf4f6a7e,0xff739bb8,
+  0xff739bb8,0xfe739ab7,0x74344754,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0x2410161a,0xe6688ca6,0xff739bb8,0xff739bb8,0xf26d93af,0x1e0d1215,0,0x6f324450,0xff739bb8,0xff739bb8,0xa74b6679,0,0x3020200,
+  0,0,0x18171302,0x3b382f04,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x34312903,0x3030300,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x11100d01,0x3b382e04,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x33302803,0x12110e01,
+  0x2020200,0x4020203,0xe5678ba5,0xff739bb8,0xfd729ab6,0x3c1b242b,0,0x35182026,0xfa7198b4,0xff739bb8,0xff739bb8,0xfc7199b6,0x5727353f,0x2010101,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x170a0e11,0xcb5c7b92,0xff739bb8,
+  0xff739bb8,0xff739bb8,0x94435a6b,0,0x5020303,0xd05e7e96,0xff739bb8,0xfe739bb8,0x5426333d,0,0,0x9090701,0x2b292203,0x403c3204,0x403d3304,0x403d3304,
+  0x403d3304,0x403d3304,0x36332b03,0x8070600,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xd0d0a01,
+  0x38352c03,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403c3204,0x302e2603,0x4040300,0x9a455d6f,0xff739bb8,0xff739bb8,0xa0486173,
+  0x1010101,0x2010101,0xa1496274,0xff739bb8,0xff739bb8,0xff739bb8,0xf56f95b1,0x74344754,0xb050708,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010101,0x2e151c22,0xd05e7f96,0xff739bb8,0xff739bb8,0xff739bb8,0xed6b90ab,
+  0x1c0d1114,0,0x451f2a32,0xfc7299b6,0xff739bb8,0xe9698ea8,0x13090c0e,0x8080701,0x211f1a02,0x3b382f04,0x403d3304,0x403d3304,0x403d3304,0x403d3304,
+  0x403d3304,0x36332a03,0xa090801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xa090801,
+  0x32302803,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x15141101,0x35182026,0xfc7299b6,0xff739bb8,0xf56e95b1,0x2b141a1f,
+  0,0x1d0d1115,0xde6487a0,0xff739bb8,0xff739bb8,0xff739bb8,0xfc7299b6,0xc358768c,0x5d2a3843,0x2e151c21,0x190b0f12,0x170b0e11,0x170a0e11,0x170a0e11,
+  0x170a0e10,0x160a0e10,0x160a0e10,0x160a0d10,0x160a0d10,0x160a0d10,0x150a0d0f,0x150a0d0f,0x15090d0f,0x15090d0f,0x14090c0f,0x14090c0f,0x14090c0e,
+  0x14090c0e,0x13090c0e,0x13090c0e,0x13090c0e,0x13080b0d,0x12080b0d,0x12080b0d,0x12080b0d,0x12080b0d,0x12080b0d,0x11080b0c,0x11080a0c,0x11080a0c,
+  0x11070a0c,0x10070a0c,0x10070a0c,0x10070a0b,0x1007090b,0xf07090b,0xf07090b,0xf07090b,0xf07090b,0xe07090a,0xe06090a,0xe06090a,0xe06080a,0xd06080a,
+  0xd06080a,0xd060809,0xd060809,0xd060809,0xc060809,0xc050709,0xc050709,0xc050708,0xb050708,0xb050708,0xb050708,0xb050608,0xa050607,0xa050607,
+  0xa040607,0xa040607,0x9040607,0x9040607,0x9040507,0x9040506,0x9040506,0x8040506,0x8040506,0x8040506,0x8030505,0x7030405,0x7030405,0x7030405,
+  0x7030405,0x6030405,0x6030404,0x6030404,0x6030304,0x5020304,0x5020304,0x5020304,0x5020303,0x4020303,0x4020303,0x4020203,0x4020203,0x3020202,
+  0x3010202,0x3010202,0x3010202,0x3010202,0x2010102,0x2010101,0x2010101,0x2010101,0x1010101,0x1010101,0x1010101,0x1010101,0x2010101,0x2010101,
+  0x2010102,0x2010102,0x3010202,0x3010202,0x3010202,0x3020202,0x4020203,0x4020203,0x4020203,0x4020303,0x5020303,0x5020303,0x5020304,0x5020304,
+  0x5020304,0x6030304,0x6030404,0x6030404,0x6030405,0x7030405,0x7030405,0x7030405,0x7030405,0x8030506,0x8040506,0x8040506,0x8040506,0x9040506,
+  0x9040506,0x9040607,0x9040607,0x9040607,0xa040607,0xa050607,0xa050607,0xb050608,0xb050708,0xb050708,0xb050708,0xb050708,0xc050708,0xc050709,
+  0xc050709,0xc060809,0xd060809,0xd060809,0xd060809,0xd06080a,0xe06080a,0xe06080a,0xe06090a,0xe06090a,0xf07090a,0xf07090b,0xf07090b,0xf07090b,
+  0x1007090b,0x10070a0b,0x10070a0c,0x10070a0c,0x10070a0c,0x11080a0c,0x11080a0c,0x11080a0c,0x11080b0d,0x12080b0d,0x12080b0d,0x12080b0d,0x12080b0d,
+  0x13080b0d,0x13080b0e,0x13090c0e,0x13090c0e,0x14090c0e,0x14090c0e,0x14090c0e,0x14090c0f,0x15090c0f,0x15090d0f,0x15090d0f,0x150a0d0f,0x150a0d0f,
+  0x160a0d10,0x160a0d10,0x160a0d10,0x160a0e10,0x170a0e10,0x170a0e11,0x170a0e11,0x170b0e11,0x180b0e11,0x200e1417,0x411d272f,0x91415869,0xec6b90aa,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xfe739ab7,0x672f3f4a,0,0x5020303,0xb7536f84,0xff739bb8,0xff739bb8,0x9e476072,0x5040400,0x37342b03,0x403d3304,
+  0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x34312903,0xb0a0801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x4040400,0x22201b02,0x3e3b3104,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x2e2c2503,0x3020202,0xbd557389,
+  0xff739bb8,0xff739bb8,0xaa4d687b,0,0,0x441f2931,0xf26d93af,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xfd729ab7,0xef6c92ad,0xe4678aa4,0xe3668aa3,
+  0xe2668aa3,0xe2668aa3,0xe26689a3,0xe26689a3,0xe26689a3,0xe26689a3,0xe26689a3,0xe16689a3,0xe16689a3,0xe16689a3,0xe16689a2,0xe16589a2,0xe16589a2,
+  0xe16589a2,0xe16588a2,0xe06588a2,0xe06588a2,0xe06588a2,0xe06588a2,0xe06588a2,0xe06588a1,0xe06588a1,0xdf6588a1,0xdf6588a1,0xdf6588a1,0xdf6588a1,
+  0xdf6588a1,0xdf6487a1,0xdf6487a1,0xde6487a1,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xdd6487a0,0xdd6487a0,
+  0xdd6486a0,0xdd64869f,0xdd64869f,0xdd64869f,0xdd63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63859e,
+  0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xda63859e,0xda62859e,0xda62859d,0xda62859d,0xda62849d,0xda62849d,
+  0xda62849d,0xd962849d,0xd962849d,0xd962849d,0xd962849d,0xd962849d,0xd962849c,0xd962849c,0xd962849c,0xd862849c,0xd862839c,0xd861839c,0xd861839c,
+  0xd861839c,0xd861839c,0xd861839c,0xd761839b,0xd761839b,0xd761839b,0xd761839b,0xd761839b,0xd761839b,0xd761829b,0xd661829b,0xd661829b,0xd661829b,
+  0xd661829a,0xd660829a,0xd660829a,0xd660829a,0xd660829a,0xd661829b,0xd661829b,0xd661829b,0xd761829b,0xd761829b,0xd761839b,0xd761839b,0xd761839b,
+  0xd761839b,0xd761839b,0xd761839b,0xd861839c,0xd861839c,0xd861839c,0xd861839c,0xd861839c,0xd862839c,0xd862849c,0xd962849c,0xd962849c,0xd962849c,
+  0xd962849d,0xd962849d,0xd962849d,0xd962849d,0xda62849d,0xda62849d,0xda62849d,0xda62849d,0xda62859d,0xda62859d,0xda62859e,0xda63859e,0xdb63859e,
+  0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdb63859e,0xdc63859e,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,
+  0xdc63869f,0xdd63869f,0xdd64869f,0xdd64869f,0xdd64869f,0xdd6486a0,0xdd6487a0,0xdd6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,0xde6487a0,
+  0xde6487a0,0xde6487a0,0xdf6487a1,0xdf6487a1,0xdf6487a1,0xdf6588a1,0xdf6588a1,0xdf6588a1,0xdf6588a1,0xdf6588a1,0xe06588a1,0xe06588a1,0xe06588a2,
+  0xe06588a2,0xe06588a2,0xe06588a2,0xe06588a2,0xe16589a2,0xe16589a2,0xe16589a2,0xe16589a2,0xe16689a2,0xe16689a3,0xe16689a3,0xe26689a3,0xe26689a3,
+  0xe26689a3,0xe26689a3,0xe26689a3,0xe2668aa3,0xe2668aa3,0xe2668aa3,0xe3668aa4,0xe8688da7,0xf97097b4,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xa3496375,0x6030304,0,0x4b222e36,0xfb7199b5,0xff739bb8,0xfa7198b5,0x34182026,0x18171302,0x403d3304,0x403d3304,0x403d3304,0x403d3304,
+  0x403d3304,0x403d3304,0x2b292203,0x6060500,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0x1010000,0xf0e0c01,0x33312903,0x3f3c3204,0x403d3304,0x403d3304,0x3f3c3204,0xb0a0801,0x4e232f38,0xfe739ab7,0xff739bb8,0xfd729ab7,
+  0x5527343e,0,0x1000000,0x5325323c,0xf46e94b0,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xfe739ab7,0xb1506c80,0xd060809,
+  0,0x11080a0c,0xd661829b,0xff739bb8,0xff739bb8,0xba547186,0x2020201,0x312f2703,0x403d3304,0x403d3304,0x403d3304,0x403d3304,0x3e3a3104,0x1f1e1902,
+  0x2020100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010000,0x14131001,
+  0x312e2603,0x3e3b3104,0x403d3304,0x29272003,0x5030304,0xb8537085,0xff739bb8,0xff739bb8,0xe8688da7,0x2912191d,0,0,0x3e1c252c,0xd861839c,0xfe739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xf46e95b0,0x8f405767,0x7030405,0,0x4020303,0x9d475f71,0xff739bb8,0xff739bb8,0xfa7198b4,0x35182026,0x11100e01,
+  0x3f3c3204,0x403d3304,0x403d3304,0x3e3b3104,0x2c2a2303,0xb0a0901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1010100,0xf0e0c01,0x201f1a02,0x302d2603,0x9080701,0x30161d22,0xf06c92ad,0xff739bb8,0xff739bb8,
+  0xcf5d7e96,0x1d0d1115,0,0,0x170a0e10,0x853c5160,0xdd64869f,0xfd729ab6,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xee6c91ac,0xb9537186,0x401d272e,0x1000101,0,0x2010101,0x78364957,0xfe729ab7,0xff739bb8,
+  0xff739bb8,0x9f486173,0x2020201,0x312f2703,0x403d3304,0x3c392f04,0x2d2a2303,0x13120f01,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x2020100,0x3030200,0x1000000,0x813a4e5d,0xfe739ab7,0xff739bb8,
+  0xff739bb8,0xc95b7a91,0x2510161a,0,0,0,0x190b0f12,0x47202b33,0x72334552,0x863c5261,0x883d5362,0x893e5363,0x893e5363,0x893e5363,0x893e5463,0x8a3e5463,
+  0x8a3e5464,0x8a3e5464,0x8b3f5464,0x8b3f5464,0x8b3f5564,0x8c3f5565,0x8c3f5565,0x8c3f5565,0x8c3f5565,0x8d3f5565,0x8d405666,0x8d405666,0x8e405666,
+  0x8e405666,0x8e405667,0x8e405767,0x8f405767,0x8f415767,0x8f415767,0x90415768,0x90415768,0x90415868,0x91415868,0x91415869,0x91415869,0x92425869,
+  0x92425969,0x92425969,0x9242596a,0x9342596a,0x9342596a,0x93425a6a,0x93435a6a,0x94435a6b,0x94435a6b,0x94435a6b,0x95435a6b,0x95435b6c,0x95435b6c,
+  0x96435b6c,0x96445b6c,0x96445b6c,0x97445b6d,0x97445c6d,0x97445c6d,0x97445c6d,0x98445c6d,0x98455c6e,0x98455d6e,0x99455d6e,0x99455d6e,0x99455d6f,
+  0x9a455d6f,0x9a455d6f,0x9a465e6f,0x9a465e6f,0x9b465e70,0x9b465e70,0x9b465e70,0x9c465f70,0x9c465f71,0x9c465f71,0x9c475f71,0x9d475f71,0x9d475f71,
+  0x9d476072,0x9e476072,0x9e476072,0x9e476072,0x9f486072,0x9f486173,0x9f486173,0xa0486173,0xa0486173,0xa0486173,0xa0486274,0xa1486274,0xa1496274,
+  0xa1496274,0xa2496275,0xa2496275,0xa2496375,0xa3496375,0xa3496375,0xa34a6376,0xa34a6376,0xa44a6376,0xa44a6476,0xa44a6476,0xa44a6476,0xa44a6476,
+  0xa44a6376,0xa34a6376,0xa3496375,0xa3496375,0xa2496375,0xa2496275,0xa2496275,0xa1496274,0xa1496274,0xa1486274,0xa0486274,0xa0486174,0xa0486173,
+  0xa0486173,0x9f486173,0x9f486173,0x9f486072,0x9e476072,0x9e476072,0x9e476072,0x9d476072,0x9d476071,0x9d475f71,0x9d475f71,0x9c475f71,0x9c465f71,
+  0x9c465f70,0x9b465e70,0x9b465e70,0x9b465e70,0x9a465e6f,0x9a465e6f,0x9a455e6f,0x99455d6f,0x99455d6f,0x99455d6e,0x99455d6e,0x98455d6e,0x98455c6e,
+  0x98445c6e,0x97445c6d,0x97445c6d,0x97445c6d,0x97445b6d,0x96445b6c,0x96445b6c,0x96435b6c,0x95435b6c,0x95435b6c,0x95435a6b,0x94435a6b,0x94435a6b,
+  0x94435a6b,0x93425a6a,0x9342596a,0x9342596a,0x9342596a,0x9242596a,0x92425969,0x92425969,0x92425869,0x91415869,0x91415869,0x91415868,0x90415868,
+  0x90415868,0x90415768,0x8f415767,0x8f415767,0x8f405767,0x8f405767,0x8e405767,0x8e405666,0x8e405666,0x8d405666,0x8d405666,0x8d3f5666,0x8c3f5565,
+  0x8c3f5565,0x8c3f5565,0x8c3f5565,0x8b3f5564,0x8b3f5464,0x8b3f5464,0x8a3e5464,0x8a3e5464,0x8a3e5463,0x893e5463,0x893e5363,0x893e5363,0x893e5363,
+  0x883e5362,0x883d5362,0x7b374b59,0x5b293742,0x2b131a1f,0x5020304,0,0,0x5020304,0x77364956,0xf87097b3,0xff739bb8,0xff739bb8,0xdf6487a1,0x1c0d1114,
+  0x100f0c01,0x2d2b2403,0x1e1d1802,0xb0a0801,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x9040607,0xb3516d81,0xff739bb8,0xff739bb8,0xff739bb8,0xde6487a0,0x4b222e36,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x12080b0d,0x9f486173,0xfb7199b5,
+  0xff739bb8,0xff739bb8,0xf97097b4,0x4d232f37,0,0x2020200,0x1010100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x10070a0b,0xd25f7f97,0xff739bb8,0xff739bb8,0xff739bb8,0xfb7199b5,0xa74b6578,
+  0x31161e24,0x7030405,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x3010202,
+  0x12080b0d,0x6b30414d,0xe6688ca6,0xff739bb8,0xff739bb8,0xff739bb8,0xfb7198b5,0x72334552,0x1000101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x220f1518,0xca5b7b92,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xfb7198b5,0xc75a798f,0x893e5363,0x652e3e49,0x5125313a,0x4f243039,0x4e233039,0x4e233038,0x4e232f38,0x4e232f38,
+  0x4d232f38,0x4d232f38,0x4d232f37,0x4c222e37,0x4c222e37,0x4c222e37,0x4c222e37,0x4b222e36,0x4b222e36,0x4b222d36,0x4a222d36,0x4a212d35,0x4a212d35,
+  0x49212d35,0x49212c35,0x49212c35,0x49212c34,0x48212c34,0x48202c34,0x48202c34,0x47202b33,0x47202b33,0x47202b33,0x46202b33,0x46202b33,0x461f2a32,
+  0x451f2a32,0x451f2a32,0x451f2a32,0x451f2a32,0x441f2a31,0x441f2931,0x441f2931,0x441e2931,0x431e2930,0x431e2930,0x431e2830,0x421e2830,0x421e2830,
+  0x421e282f,0x411d282f,0x411d282f,0x411d272f,0x401d272e,0x401d272e,0x401d272e,0x401d272e,0x3f1d272e,0x3f1c262d,0x3f1c262d,0x3e1c262d,0x3e1c262d,
+  0x3e1c262d,0x3e1c252c,0x3d1c252c,0x3d1b252c,0x3d1b252c,0x3c1b252c,0x3c1b242b,0x3c1b242b,0x3b1b242b,0x3b1b242b,0x3b1b242a,0x3b1a242a,0x3a1a232a,
+  0x3a1a232a,0x3a1a232a,0x391a2329,0x391a2329,0x391a2229,0x38192229,0x38192229,0x38192228,0x37192228,0x37192228,0x37192128,0x37192127,0x36192127,
+  0x36182127,0x36182127,0x36182127,0x35182026,0x35182026,0x35182026,0x34182026,0x34172025,0x34171f25,0x33171f25,0x33171f25,0x33171f25,0x33171f25,
+  0x33171f25,0x33171f25,0x34171f25,0x34182026,0x34182026,0x35182026,0x35182026,0x35182026,0x36182127,0x36182127,0x36182127,0x36192127,0x37192128,
+  0x37192228,0x37192228,0x38192228,0x38192228,0x38192229,0x391a2229,0x391a2329,0x391a2329,0x3a1a232a,0x3a1a232a,0x3a1a232a,0x3b1a242a,0x3b1a242a,
+  0x3b1b242b,0x3b1b242b,0x3c1b242b,0x3c1b242b,0x3c1b252c,0x3d1b252c,0x3d1b252c,0x3d1c252c,0x3e1c252c,0x3e1c262d,0x3e1c262d,0x3e1c262d,0x3f1c262d,
+  0x3f1c262d,0x3f1d262e,0x401d272e,0x401d272e,0x401d272e,0x401d272f,0x411d272f,0x411d282f,0x411d282f,0x421e282f,0x421e2830,0x421e2830,0x431e2930,
+  0x431e2930,0x431e2930,0x441e2931,0x441f2931,0x441f2931,0x441f2a31,0x451f2a32,0x451f2a32,0x451f2a32,0x461f2a32,0x461f2a32,0x46202b33,0x46202b33,
+  0x47202b33,0x47202b33,0x47202b33,0x48202c34,0x48202c34,0x48212c34,0x49212c34,0x49212c34,0x49212c35,0x49212d35,0x4a212d35,0x4a212d35,0x4a212d36,
+  0x4b222d36,0x4b222d36,0x4b222e36,0x4b222e36,0x4c222e37,0x4c222e37,0x4c222e37,0x4d232f37,0x4d232f38,0x4d232f38,0x4d232f38,0x4e232f38,0x4e232f38,
+  0x4e233039,0x4f233039,0x4f243039,0x5c293842,0x7a374a58,0xa94c677a,0xed6b90ab,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xf97097b4,0x823b4f5e,
+  0x2010101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x190b0f12,0xb3516d81,0xfe739ab7,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xef6c91ad,0x662e3e49,0x2010101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xe06080a,0x76354855,0xed6b90ab,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xfe739bb7,0xc559788e,0x3f1c262d,0x1000001,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1000101,0x2410161a,0x9b465e70,0xef6c91ac,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,0xff739bb8,
+  0xff739bb8,0xfe739ab7,0xd15e7f97,0x5f2b3a45,0xa050607,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xa040607,0x5325323c,0x853c5160,0xa54a6477,0xbe567389,
+  0xc057758b,0xc157758b,0xc157758b,0xc157758b,0xc257768c,0xc258768c,0xc258768c,0xc358768c,0xc358768d,0xc358778d,0xc358778d,0xc458778d,0xc458778d,
+  0xc459778e,0xc559778e,0xc559788e,0xc559788e,0xc659788f,0xc659788f,0xc659788f,0xc659798f,0xc75a798f,0xc75a7990,0xc75a7990,0xc85a7990,0xc85a7a90,
+  0xc85a7a90,0xc85a7a91,0xc95b7a91,0xc95b7a91,0xc95b7a91,0xca5b7b92,0xca5b7b92,0xca5b7b92,0xcb5b7b92,0xcb5b7b92,0xcb5c7b93,0xcc5c7c93,0xcc5c7c93,
+  0xcc5c7c93,0xcc5c7c93,0xcd5c7c94,0xcd5c7d94,0xcd5d7d94,0xce5d7d94,0xce5d7d95,0xce5d7d95,0xce5d7d95,0xcf5d7e95,0xcf5d7e95,0xcf5d7e96,0xd05e7e96,
+  0xd05e7e96,0xd05e7f96,0xd15e7f96,0xd15e7f97,0xd15e7f97,0xd15e7f97,0xd25f8097,0xd25f8098,0xd25f8098,0xd35f8098,0xd35f8098,0xd35f8098,0xd35f8199,
+  0xd4608199,0xd4608199,0xd4608199,0xd5608199,0xd560829a,0xd560829a,0xd660829a,0xd660829a,0xd661829b,0xd661829b,0xd761839b,0xd761839b,0xd761839b,
+  0xd861839c,0xd861839c,0xd862839c,0xd962849c,0xd962849d,0xd962849d,0xda62849d,0xda62849d,0xda62859d,0xda62859e,0xdb63859e,0xdb63859e,0xdb63859e,
+  0xdc63859e,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdc63869f,0xdb63859e,0xdb63859e,0xdb63859e,0xda63859e,0xda62859d,0xda62849d,
+  0xda62849d,0xd962849d,0xd962849d,0xd962849c,0xd862839c,0xd861839c,0xd861839c,0xd761839b,0xd761839b,0xd761839b,0xd661829b,0xd661829b,0xd660829a,
+  0xd660829a,0xd560829a,0xd560829a,0xd560819a,0xd5608199,0xd4608199,0xd4608199,0xd45f8199,0xd35f8098,0xd35f8098,0xd35f8098,0xd25f8098,0xd25f8098,
+  0xd25f7f97,0xd15e7f97,0xd15e7f97,0xd15e7f97,0xd15e7f96,0xd05e7f96,0xd05e7e96,0xd05e7e96,0xcf5d7e96,0xcf5d7e95,0xcf5d7e95,0xce5d7d95,0xce5d7d95,
+  0xce5d7d95,0xce5d7d94,0xcd5d7d94,0xcd5c7d94,0xcd5c7c94,0xcc5c7c93,0xcc5c7c93,0xcc5c7c93,0xcb5c7c93,0xcb5c7b93,0xcb5b7b92,0xcb5b7b92,0xca5b7b92,
+  0xca5b7b92,0xca5b7b92,0xc95b7a91,0xc95b7a91,0xc95b7a91,0xc85a7a91,0xc85a7a90,0xc85a7a90,0xc85a7990,0xc75a7990,0xc75a7990,0xc75a798f,0xc75a798f,
+  0xc659788f,0xc659788f,0xc659788f,0xc559788e,0xc559788e,0xc559788e,0xc459778e,0xc458778d,0xc458778d,0xc358778d,0xc358778d,0xc358778d,0xc358768c,
+  0xc258768c,0xc258768c,0xc257768c,0xc157768c,0xc157758b,0xc157758b,0xc157758b,0xc057758b,0xb4516e82,0x96445b6c,0x73344653,0x2912191e,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0};
+const unsigned int* LogoPixels::logo_1x = temp1;
+const unsigned int* LogoPixels::logo_2x = temp2;
@@ -0,0 +1,14 @@
+/* (Auto-generated pixel data file). */
+
+#pragma once
+
+namespace LogoPixels
+{
+    // Premultiplied 0xAARRGGBB, row by row, as in juce::PixelARGB
+    extern const unsigned int*  logo_1x;
+    const int                   logo_1xWidth = 180;
+    const int                   logo_1xHeight = 88;
+    extern const unsigned int*  logo_2x;
+    const int                   logo_2xWidth = 360;
+    const int                   logo_2xHeight = 176;
+}
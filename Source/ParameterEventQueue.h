@@ -0,0 +1,25 @@
+/*
+  ==============================================================================
+
+    ParameterEventQueue.h
+
+    A lock-free queue of timestamped parameter changes.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "SpscQueue.h"
+
+//==============================================================================
+/** A parameter change at a sample offset into the next processed block. */
+struct ParameterEvent
+{
+    int sampleOffset;
+    int parameter;
+    float value;
+};
+
+/** Parameter changes queued for the audio thread. */
+using ParameterEventQueue = SpscQueue<ParameterEvent>;
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    ParameterRamp.h
+
+    Block-wise linear smoothing of a parameter into a buffer of per-sample
+    values.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    A linear ramp towards a target value, rendered a block at a time.
+
+    Unlike juce::SmoothedValue, which is stepped once per sample, a ParameterRamp
+    writes a whole block of values in one go using juce::dsp::SIMDRegister, and
+    does no work at all while the value is stationary. Consumers read the result
+    through getValues(), which gives stride 0 for a stationary value so that the
+    same indexing code works in both cases without a per-sample branch.
+*/
+class ParameterRamp
+{
+public:
+    //==============================================================================
+    /** A view of the values for the current block. */
+    struct Values
+    {
+        const float* data;
+        int stride;
+
+        float operator[] (int index) const noexcept    { return data[index * stride]; }
+    };
+
+    //==============================================================================
+    ParameterRamp() = default;
+
+    /** Allocates the ramp buffer. Not real-time safe. */
+    void prepare (double newSampleRate, int maximumBlockSize)
+    {
+        jassert (newSampleRate > 0 && maximumBlockSize > 0);
+
+        capacity = maximumBlockSize;
+
+        const auto numLanes = (int) SIMDFloat::SIMDNumElements;
+        storage.calloc ((size_t) (capacity + 2 * numLanes));
+        ramp = SIMDFloat::getNextSIMDAlignedPtr (storage.get());
+
+        setSampleRate (newSampleRate);
+        reset();
+    }
+
+    /** Frees the ramp buffer until the next call to prepare(). */
+    void release()
+    {
+        storage.free();
+        ramp = nullptr;
+        capacity = 0;
+    }
+
+    /** Changes the sample rate without reallocating. */
+    void setSampleRate (double newSampleRate) noexcept
+    {
+        jassert (newSampleRate > 0);
+
+        sampleRate = newSampleRate;
+        setRampLength (rampLengthSeconds);
+    }
+
+    /** Sets the time taken to move to a new target value. */
+    void setRampLength (double newRampLengthSeconds) noexcept
+    {
+        jassert (newRampLengthSeconds >= 0.0);
+
+        rampLengthSeconds = newRampLengthSeconds;
+        rampLengthSamples = juce::jmax (1, (int) std::floor (rampLengthSeconds * sampleRate));
+    }
+
+    //==============================================================================
+    /** Starts a ramp from the current value to a new target. */
+    void setTargetValue (float newTarget) noexcept
+    {
+        if (newTarget == target)
+            return;
+
+        target = newTarget;
+        samplesRemaining = rampLengthSamples;
+        step = (target - current) / (float) samplesRemaining;
+    }
+
+    /** Jumps straight to the target value. */
+    void reset() noexcept
+    {
+        current = target;
+        samplesRemaining = 0;
+    }
+
+    bool isRamping() const noexcept             { return samplesRemaining > 0; }
+    float getCurrentValue() const noexcept      { return current; }
+    float getTargetValue() const noexcept       { return target; }
+
+    //==============================================================================
+    /** Advances the ramp by numSamples, rendering them if the value is moving.
+
+        The returned view stays valid until the next call to process().
+    */
+    Values process (int numSamples) noexcept
+    {
+        jassert (numSamples <= capacity);
+
+        if (samplesRemaining <= 0)
+            return { &current, 0 };
+
+        const auto numLanes    = (int) SIMDFloat::SIMDNumElements;
+        const auto numRamped   = juce::jmin (numSamples, samplesRemaining);
+        const auto laneStep    = SIMDFloat::expand (step * (float) numLanes);
+
+        auto values = SIMDFloat::expand (current);
+
+        for (int lane = 0; lane < numLanes; ++lane)
+            values.set ((size_t) lane, current + step * (float) (lane + 1));
+
+        for (int i = 0; i < numRamped; i += numLanes)
+        {
+            values.copyToRawArray (ramp + i);
+            values += laneStep;
+        }
+
+        samplesRemaining -= numRamped;
+
+        if (samplesRemaining == 0)
+        {
+            current = target;
+            juce::FloatVectorOperations::fill (ramp + numRamped, target, numSamples - numRamped);
+        }
+        else
+        {
+            current = ramp[numRamped - 1];
+        }
+
+        return { ramp, 1 };
+    }
+
+private:
+    //==============================================================================
+    using SIMDFloat = juce::dsp::SIMDRegister<float>;
+
+    juce::HeapBlock<float> storage;
+    float* ramp = nullptr;
+    int capacity = 0;
+
+    double sampleRate = 44100.0, rampLengthSeconds = 0.05;
+    int rampLengthSamples = 1, samplesRemaining = 0;
+    float current = 0.0f, target = 0.0f, step = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE (ParameterRamp)
+};
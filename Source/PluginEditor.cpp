@@ -11,11 +11,12 @@
 
 //==============================================================================
 BasicChorusAudioProcessorEditor::BasicChorusAudioProcessorEditor (BasicChorusAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
+    : AudioProcessorEditor (&p), loadMeter (p.getProcessTimer()), scopeDisplay (p), audioProcessor (p)
 {
-    getLookAndFeel().setColour (juce::Slider::ColourIds::thumbColourId, juce::Colour::fromRGB (242, 202, 16));
-    getLookAndFeel().setColour (juce::Slider::ColourIds::rotarySliderFillColourId, juce::Colour::fromRGB (115, 155, 184));
-    getLookAndFeel().setColour (juce::Slider::ColourIds::rotarySliderOutlineColourId, juce::Colour::fromRGB (44, 53, 57));
+    // Everything is drawn over a solid background, so nothing behind the
+    // editor has to be repainted with it.
+    setOpaque (true);
+    setLookAndFeel (lookAndFeel.get());
     
     using SliderStyle    = juce::Slider::SliderStyle;
     using Attachment     = juce::SliderParameterAttachment;
@@ -53,7 +54,7 @@ BasicChorusAudioProcessorEditor::BasicChorusAudioProcessorEditor (BasicChorusAud
     mixLabel.setJustificationType (juce::Justification::centred);
     addAndMakeVisible (mixLabel);
     
-    pluginTitle.setFont (currentFont.boldened().withHeight (60.0f));
+    pluginTitle.setFont (juce::Font (60.0f, juce::Font::bold));
     pluginTitle.setColour (juce::Label::ColourIds::textColourId, juce::Colours::white);
     addAndMakeVisible (pluginTitle);
     
@@ -66,30 +67,48 @@ BasicChorusAudioProcessorEditor::BasicChorusAudioProcessorEditor (BasicChorusAud
     mixSliderAttachment         = std::make_unique<Attachment>(*apvts.getParameter ("MIX"), mixSlider);
     
     addAndMakeVisible (tapImage);
+    addAndMakeVisible (loadMeter);
+    addAndMakeVisible (scopeDisplay);
     
     setSize (400, 350);
 }
 
 BasicChorusAudioProcessorEditor::~BasicChorusAudioProcessorEditor()
 {
+    setLookAndFeel (nullptr);
 }
 
 //==============================================================================
 void BasicChorusAudioProcessorEditor::paint (juce::Graphics& g)
 {
+    if (! hasPainted)
+        firstPaintStartTicks = juce::Time::getHighResolutionTicks();
+    
     g.fillAll (juce::Colours::black);
-    currentFont = g.getCurrentFont();
+}
+
+void BasicChorusAudioProcessorEditor::paintOverChildren (juce::Graphics&)
+{
+    if (hasPainted)
+        return;
+    
+    hasPainted = true;
+    audioProcessor.getStartupProfile().record (StartupProfile::Stage::firstPaint, firstPaintStartTicks,
+                                               juce::Time::getHighResolutionTicks());
 }
 
 void BasicChorusAudioProcessorEditor::resized()
 {
-    const auto column0     = 0.05f;
-    const auto column1     = 0.28f;
-    const auto column2     = 0.52f;
+    // The dials in the left two columns stop short of column2, leaving the
+    // right-hand column clear for the scope, the mix dial and the load meter
+    const auto column0     = 0.04f;
+    const auto column1     = 0.30f;
+    const auto column2     = 0.60f;
     const auto row0        = 0.27f;
     const auto row1        = 0.67f;
     const auto row2        = 0.40f;
-    const auto dialSize    = 0.30f;
+    const auto dialSize    = 0.26f;
+    const auto mixSize     = 0.36f;
     const auto labelSpace  = 0.03f;
     const auto labelHeight = 0.05f;
     
@@ -108,6 +127,9 @@ void BasicChorusAudioProcessorEditor::resized()
     feedbackLabel.setBoundsRelative (column1, row1 - labelSpace, dialSize, labelHeight);
     feedbackSlider.setBoundsRelative (column1, row1, dialSize, dialSize);
 
-    mixLabel.setBoundsRelative (column2, row2 - labelSpace, dialSize + (dialSize * 0.33f), labelHeight);
-    mixSlider.setBoundsRelative (column2, row2, dialSize + (dialSize * 0.33f), dialSize + (dialSize * 0.33f));
+    mixLabel.setBoundsRelative (column2, row2 - labelSpace, mixSize, labelHeight);
+    mixSlider.setBoundsRelative (column2, row2, mixSize, mixSize);
+    
+    scopeDisplay.setBoundsRelative (column2, 0.21f, mixSize, 0.14f);
+    loadMeter.setBoundsRelative (column2, 0.9f, mixSize, labelHeight);
 }
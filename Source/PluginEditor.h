@@ -10,29 +10,308 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
-#include "Assets.h"
+#include "ChorusLookAndFeel.h"
+#include "LogoPixels.h"
 
-class TapImage : public juce::ImageComponent
+//==============================================================================
+/**
+    The logo, shared by every editor through a juce::SharedResourcePointer. The
+    last size it was made at is kept, as every editor draws it at the same size.
+    
+    Tools/make_logo_pixels.py builds the logo into the binary already decoded at
+    the editor's 1x and 2x sizes, so those are only copied. Any other size is
+    resampled once from the 2x pixels.
+*/
+class SharedLogo
+{
+public:
+    /** The logo at exactly this many pixels. */
+    const juce::Image& getScaledImage (int width, int height)
+    {
+        if (scaledImage.getWidth() == width && scaledImage.getHeight() == height)
+            return scaledImage;
+        
+        if (width == LogoPixels::logo_1xWidth && height == LogoPixels::logo_1xHeight)
+            scaledImage = createImage (LogoPixels::logo_1x, width, height);
+        else if (width == LogoPixels::logo_2xWidth && height == LogoPixels::logo_2xHeight)
+            scaledImage = createImage (LogoPixels::logo_2x, width, height);
+        else
+            scaledImage = createImage (LogoPixels::logo_2x, LogoPixels::logo_2xWidth, LogoPixels::logo_2xHeight)
+                            .rescaled (width, height, juce::Graphics::highResamplingQuality);
+        
+        return scaledImage;
+    }
+    
+private:
+    static juce::Image createImage (const unsigned int* pixels, int width, int height)
+    {
+        // The pixels are already premultiplied juce::PixelARGBs
+        juce::Image image (juce::Image::ARGB, width, height, false);
+        juce::Image::BitmapData data (image, juce::Image::BitmapData::writeOnly);
+        jassert (data.pixelStride == (int) sizeof (juce::PixelARGB));
+        
+        for (int y = 0; y < height; ++y)
+            std::memcpy (data.getLinePointer (y), pixels + (size_t) (y * width), (size_t) width * sizeof (juce::PixelARGB));
+        
+        return image;
+    }
+    
+    juce::Image scaledImage;
+};
+
+//==============================================================================
+/** The logo, stretched to fill the component, which links to the website. */
+class TapImage : public juce::Component
 {
 public:
     TapImage()
     {
-        tapImage = juce::ImageCache::getFromMemory (Assets::Lockup_3_Curves_png, Assets::Lockup_3_Curves_pngSize);
-        jassert (tapImage.isValid());
-        setImage (tapImage, juce::RectanglePlacement::stretchToFit);
         addAndMakeVisible (websiteButton);
     }
     
+    void paint (juce::Graphics& g) override
+    {
+        // The logo is drawn pixel for pixel, so it's never resampled in paint()
+        const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const auto& image = logo->getScaledImage (juce::jmax (1, juce::roundToInt ((float) getWidth() * scale)),
+                                                  juce::jmax (1, juce::roundToInt ((float) getHeight() * scale)));
+        
+        g.drawImage (image, getLocalBounds().toFloat());
+    }
+    
     void resized() override
     {
         websiteButton.setBounds (getLocalBounds());
     }
     
 private:
-    juce::Image tapImage;
+    juce::SharedResourcePointer<SharedLogo> logo;
     juce::HyperlinkButton websiteButton { "", juce::URL ("https://theaudioprogrammer.com") };
 };
 
+//==============================================================================
+/**
+    Shows the share of each block's deadline spent processing, with the 99th
+    percentile block time, over the last poll interval. It only ever reads the
+    processor's timer, so it never holds up the audio thread.
+*/
+class LoadMeter  : public juce::Component,
+                   private juce::Timer
+{
+public:
+    explicit LoadMeter (const ProcessTimer& timerToShow)
+        : timer (timerToShow)
+    {
+        setOpaque (true);
+    }
+    
+    void visibilityChanged() override         { updatePolling(); }
+    void parentHierarchyChanged() override    { updatePolling(); }
+    
+    void paint (juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+        g.setColour (juce::Colour::fromRGB (44, 53, 57));
+        g.fillRect (bounds);
+        
+        const auto load = (float) juce::jlimit (0.0, 1.0, statistics.deadlineFraction);
+        g.setColour (statistics.overrunFraction > 0.0 ? juce::Colours::red : juce::Colour::fromRGB (115, 155, 184));
+        g.fillRect (bounds.withWidth (bounds.getWidth() * load));
+        
+        g.setColour (juce::Colours::white);
+        g.setFont (12.0f);
+        g.drawText (text, getLocalBounds().reduced (4, 0), juce::Justification::centredLeft, false);
+    }
+    
+private:
+    /** Polls only while on screen, starting from a fresh snapshot. */
+    void updatePolling()
+    {
+        if (isShowing() == isTimerRunning())
+            return;
+        
+        if (isShowing())
+        {
+            timer.getSnapshot (snapshots[latest]);
+            startTimerHz (10);
+        }
+        else
+        {
+            stopTimer();
+        }
+    }
+    
+    void timerCallback() override
+    {
+        auto& previous = snapshots[latest];
+        latest ^= 1;
+        timer.getSnapshot (snapshots[latest]);
+        
+        statistics = snapshots[latest].getStatisticsSince (previous);
+        
+        const auto newText = "CPU " + juce::String (statistics.deadlineFraction * 100.0, 1) + "%  p99 "
+                               + juce::String (juce::roundToInt (statistics.p99Microseconds)) + " us";
+        
+        if (newText != text)
+        {
+            text = newText;
+            repaint();
+        }
+    }
+    
+    const ProcessTimer& timer;
+    ProcessTimer::Snapshot snapshots[2];
+    int latest = 0;
+    ProcessTimer::Statistics statistics;
+    juce::String text;
+};
+
+//==============================================================================
+/**
+    Plots the modulated delay time of the first voice over the last couple of
+    seconds, with the dry and wet peaks alongside.
+    
+    Readings come from the processor's lock-free queue and are drained at no
+    more than 30 frames a second. The grid is drawn once into an image at the
+    display's scale, so a frame is that image, one path and two bars.
+*/
+class ScopeDisplay  : public juce::Component,
+                      private juce::Timer
+{
+public:
+    explicit ScopeDisplay (BasicChorusAudioProcessor& processorToShow)
+        : processor (processorToShow), maximumDelayMs (processorToShow.getMaximumDelayMs())
+    {
+        setOpaque (true);
+    }
+    
+    ~ScopeDisplay() override
+    {
+        if (isTimerRunning())
+            processor.setScopeEnabled (false);
+    }
+    
+    void visibilityChanged() override         { updateCapture(); }
+    void parentHierarchyChanged() override    { updateCapture(); }
+    
+    void paint (juce::Graphics& g) override
+    {
+        const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        
+        if (background.isNull() || scale != backgroundScale)
+            drawBackground (scale);
+        
+        g.drawImage (background, getLocalBounds().toFloat());
+        
+        const auto plot = getPlotBounds();
+        trace.clear();
+        
+        for (int i = 0; i < historySize; ++i)
+        {
+            const auto& snapshot = history[(size_t) ((nextIndex + i) % historySize)];
+            const auto x = plot.getX() + plot.getWidth() * (float) i / (float) (historySize - 1);
+            const auto y = plot.getBottom() - plot.getHeight() * juce::jlimit (0.0f, 1.0f, snapshot.delayMs / maximumDelayMs);
+            
+            if (i == 0)
+                trace.startNewSubPath (x, y);
+            else
+                trace.lineTo (x, y);
+        }
+        
+        g.setColour (juce::Colour::fromRGB (242, 202, 16));
+        g.strokePath (trace, juce::PathStrokeType (1.5f));
+        
+        const auto& latest = history[(size_t) ((nextIndex + historySize - 1) % historySize)];
+        auto meters = getLocalBounds().toFloat().removeFromRight (meterWidth * 2.0f).reduced (1.0f);
+        
+        const auto drawMeter = [&] (float level, juce::Colour colour)
+        {
+            auto meter = meters.removeFromLeft (meterWidth).reduced (1.0f, 0.0f);
+            g.setColour (colour);
+            g.fillRect (meter.removeFromBottom (meter.getHeight() * juce::jlimit (0.0f, 1.0f, level)));
+        };
+        
+        drawMeter (latest.dryPeak, juce::Colours::grey);
+        drawMeter (latest.wetPeak, juce::Colour::fromRGB (115, 155, 184));
+    }
+    
+private:
+    static constexpr int historySize = 200;
+    static constexpr float meterWidth = 6.0f;
+    
+    /** The processor only captures, and the queue is only allocated, once the
+        scope is actually on screen.
+    */
+    void updateCapture()
+    {
+        const auto shouldCapture = isShowing();
+        
+        if (shouldCapture == isTimerRunning())
+            return;
+        
+        processor.setScopeEnabled (shouldCapture);
+        
+        if (shouldCapture)
+            startTimerHz (30);
+        else
+            stopTimer();
+    }
+    
+    juce::Rectangle<float> getPlotBounds() const
+    {
+        return getLocalBounds().toFloat().withTrimmedRight (meterWidth * 2.0f).reduced (2.0f);
+    }
+    
+    void drawBackground (float scale)
+    {
+        backgroundScale = scale;
+        background = juce::Image (juce::Image::RGB, juce::jmax (1, juce::roundToInt ((float) getWidth() * scale)),
+                                  juce::jmax (1, juce::roundToInt ((float) getHeight() * scale)), true);
+        
+        juce::Graphics g (background);
+        g.addTransform (juce::AffineTransform::scale (scale));
+        g.fillAll (juce::Colours::black);
+        
+        const auto plot = getPlotBounds();
+        g.setColour (juce::Colour::fromRGB (44, 53, 57));
+        g.drawRect (plot);
+        
+        // A line every 20 ms of delay
+        for (auto delayMs = 20.0f; delayMs < maximumDelayMs; delayMs += 20.0f)
+            g.drawHorizontalLine (juce::roundToInt (plot.getBottom() - plot.getHeight() * delayMs / maximumDelayMs),
+                                  plot.getX(), plot.getRight());
+    }
+    
+    void timerCallback() override
+    {
+        auto changed = false;
+        
+        for (ScopeSnapshot snapshot; processor.popScopeSnapshot (snapshot);)
+        {
+            history[(size_t) nextIndex] = snapshot;
+            nextIndex = (nextIndex + 1) % historySize;
+            changed = true;
+        }
+        
+        if (changed)
+            repaint();
+    }
+    
+    void resized() override
+    {
+        background = {};
+    }
+    
+    BasicChorusAudioProcessor& processor;
+    const float maximumDelayMs;
+    std::array<ScopeSnapshot, historySize> history {};
+    int nextIndex = 0;
+    
+    juce::Image background;
+    float backgroundScale = 1.0f;
+    juce::Path trace;
+};
+
 //==============================================================================
 /**
 */
@@ -44,9 +323,12 @@ public:
 
     //==============================================================================
     void paint (juce::Graphics&) override;
+    void paintOverChildren (juce::Graphics&) override;
     void resized() override;
 
 private:
+    // Declared first so that it outlives every component that draws with it
+    juce::SharedResourcePointer<ChorusLookAndFeel> lookAndFeel;
     
     juce::Slider rateSlider;
     juce::Slider depthSlider;
@@ -70,9 +352,14 @@ private:
     Attachment mixSliderAttachment;
     
     TapImage tapImage;
-    juce::Font currentFont;
+    LoadMeter loadMeter;
+    ScopeDisplay scopeDisplay;
         
     BasicChorusAudioProcessor& audioProcessor;
+    
+    // Times the first full paint, children included, for the startup profile
+    bool hasPainted { false };
+    juce::int64 firstPaintStartTicks { 0 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BasicChorusAudioProcessorEditor)
 };
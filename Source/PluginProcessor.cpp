@@ -8,6 +8,7 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "FactoryPresets.h"
 
 //==============================================================================
 BasicChorusAudioProcessor::BasicChorusAudioProcessor()
@@ -22,20 +23,35 @@ BasicChorusAudioProcessor::BasicChorusAudioProcessor()
                        ), apvts (*this, nullptr, "Parameters", createParameters())
 #endif
 {
-    apvts.addParameterListener ("RATE", this);
-    apvts.addParameterListener ("DEPTH", this);
-    apvts.addParameterListener ("CENTREDELAY", this);
-    apvts.addParameterListener ("FEEDBACK", this);
-    apvts.addParameterListener ("MIX", this);
+    rateParameter               = apvts.getRawParameterValue ("RATE");
+    depthParameter              = apvts.getRawParameterValue ("DEPTH");
+    centreDelayParameter        = apvts.getRawParameterValue ("CENTREDELAY");
+    feedbackParameter           = apvts.getRawParameterValue ("FEEDBACK");
+    mixParameter                = apvts.getRawParameterValue ("MIX");
+    voicesParameter             = apvts.getRawParameterValue ("VOICES");
+    lfoShapeParameter           = apvts.getRawParameterValue ("LFOSHAPE");
+    interpolationParameter      = apvts.getRawParameterValue ("INTERPOLATION");
+    oversamplingParameter       = apvts.getRawParameterValue ("OVERSAMPLING");
+    oversamplingFilterParameter = apvts.getRawParameterValue ("OVERSAMPLINGFILTER");
+    channelSpreadParameter      = apvts.getRawParameterValue ("CHANNELSPREAD");
+    
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+    {
+        stateParameters[i] = apvts.getParameter (StateFormat::parameterIds[i]);
+        stateValues[i] = apvts.getRawParameterValue (StateFormat::parameterIds[i]);
+        jassert (stateParameters[i] != nullptr && stateValues[i] != nullptr);
+    }
+    
+    // The factory presets come first, so their numbers never change when the
+    // user bank grows. The user bank is left until a program is asked for, so
+    // constructing the plugin doesn't touch the disk.
+    presetBank.addBank (FactoryPresets::factory_bank, (size_t) FactoryPresets::factory_bankSize);
+    
+    startupProfile.recordSinceCreation (StartupProfile::Stage::constructor);
 }
 
 BasicChorusAudioProcessor::~BasicChorusAudioProcessor()
 {
-    apvts.removeParameterListener ("RATE", this);
-    apvts.removeParameterListener ("DEPTH", this);
-    apvts.removeParameterListener ("CENTREDELAY", this);
-    apvts.removeParameterListener ("FEEDBACK", this);
-    apvts.removeParameterListener ("MIX", this);
 }
 
 //==============================================================================
@@ -73,48 +89,319 @@ bool BasicChorusAudioProcessor::isMidiEffect() const
 
 double BasicChorusAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    const auto latencySeconds = getSampleRate() > 0.0 ? getLatencySamples() / getSampleRate() : 0.0;
+    
+    return latencySeconds + calculateTailSeconds (centreDelayParameter->load(),
+                                                  depthParameter->load(),
+                                                  feedbackParameter->load());
+}
+
+double BasicChorusAudioProcessor::calculateTailSeconds (float centreDelayMs, float depth, float feedback) noexcept
+{
+    // The longest delay a voice can reach, repeated until the feedback has
+    // brought it down to the silence threshold.
+    const auto longestDelaySeconds = (centreDelayMs + depth * ChorusEngineBase::maxDepthMs) / 1000.0;
+    const auto feedbackGain = (double) std::abs (feedback);
+    
+    if (feedbackGain >= 1.0)
+        return maxTailSeconds;
+    
+    const auto numRepeats = feedbackGain > silenceThreshold ? std::log (silenceThreshold) / std::log (feedbackGain) : 0.0;
+    return juce::jmin (maxTailSeconds, longestDelaySeconds * (1.0 + std::ceil (numRepeats)));
 }
 
 int BasicChorusAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    // NB: some hosts don't cope very well if you tell them there are 0 programs,
+    // so this should be at least 1, even if the bank is empty.
+    loadUserBank();
+    return juce::jmax (1, presetBank.getNumPresets());
 }
 
 int BasicChorusAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
 void BasicChorusAudioProcessor::setCurrentProgram (int index)
 {
+    loadUserBank();
+    
+    if (! juce::isPositiveAndBelow (index, presetBank.getNumPresets()))
+        return;
+    
+    currentProgram = index;
+    
+    if (juce::MessageManager::existsAndIsCurrentThread())
+    {
+        pendingProgram = -1;
+        
+        const auto& preset = presetBank.getPreset (index);
+        applyParameterValues (preset.values, preset.numValues);
+        return;
+    }
+    
+    // Some hosts switch programs from the audio thread, where the host mustn't
+    // be notified. Only the index is passed on: the audio thread crossfades to
+    // the preset's values, and the timer brings the parameters in line.
+    pendingProgram = index;
 }
 
 const juce::String BasicChorusAudioProcessor::getProgramName (int index)
 {
-    return {};
+    loadUserBank();
+    return presetBank.getPresetName (index);
 }
 
 void BasicChorusAudioProcessor::changeProgramName (int index, const juce::String& newName)
 {
+    // Names can be read from any thread, but are only changed from this one
+    JUCE_ASSERT_MESSAGE_THREAD
+    loadUserBank();
+    presetBank.setPresetName (index, newName);
 }
 
 //==============================================================================
 void BasicChorusAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    const StartupProfile::ScopedStage stage (startupProfile, StartupProfile::Stage::prepareToPlay);
+    
     juce::dsp::ProcessSpec spec;
     spec.maximumBlockSize = samplesPerBlock;
     spec.sampleRate = sampleRate;
+    spec.numChannels = (juce::uint32) getTotalNumOutputChannels();
+    
+    // Oversampling changes the latency, so the offline profile can only add it
+    // here; hosts signal offline rendering before preparing for a bounce.
+    preparedSampleRate = sampleRate;
+    preparedForOffline = offlineQualityEnabled = isNonRealtime();
+    
+    // From here on programs can be switched on the audio thread, which mustn't
+    // be the one to read the user bank.
+    loadUserBank();
+    
+    if (parameterEvents == nullptr)
+        parameterEvents = std::make_unique<ParameterEventQueue> (1024);
+    
+    // The host picks the precision before preparing, so only one chain is needed
+    if (isUsingDoublePrecision())
+    {
+        releaseChain (floatChain);
+        prepareChain (doubleChain, spec);
+    }
+    else
+    {
+        releaseChain (doubleChain);
+        prepareChain (floatChain, spec);
+    }
+    
+    isIdle = false;
+    silentSamplesSeen = 0;
+    
+    // Builds what a change of oversampling needs, and reports latency changes
+    // and programs switched off the message thread
+    if (! isTimerRunning())
+        startTimerHz (20);
+    processTimer.prepare (sampleRate);
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::prepareChain (ProcessingChain<SampleType>& chain, const juce::dsp::ProcessSpec& spec)
+{
+    const juce::ScopedLock lock (chainLock);
+    
+    // The offline profile oversamples at least 2x
+    const auto parameters = loadParameters();
+    const auto stages = juce::jmax (parameters.oversampling, preparedForOffline ? 1 : 0);
+    const auto filter = parameters.oversamplingFilter;
+    
+    // Hosts often prepare again on every transport start or device change. If
+    // the chain already has room for the spec and the oversampling in use it's
+    // only reconfigured, which doesn't depend on the size of the buffers.
+    const auto& allocated = chain.allocatedSpec;
+    
+    if (spec.numChannels != allocated.numChannels
+         || spec.sampleRate > allocated.sampleRate
+         || spec.maximumBlockSize > allocated.maximumBlockSize
+         || stages > juce::jmin (chain.chorusStages[0], chain.chorusStages[1]))
+    {
+        auto allocationSpec = spec;
+        allocationSpec.sampleRate = juce::jmax (spec.sampleRate, maximumSampleRate);
+        allocationSpec.maximumBlockSize = juce::jmax (spec.maximumBlockSize, (juce::uint32) maximumBlockSize);
+        
+        allocateChain (chain, allocationSpec, stages, filter);
+    }
+    else if (stages > 0)
+    {
+        createOversampler (chain, stages, filter);
+    }
+    
+    chain.activeChorus = chain.choruses[0].get();
+    
+    for (auto& chorus : chain.choruses)
+    {
+        chorus->setRampLength (parameterRampLength);
+        chorus->setHighPrecisionLfo (offlineQualityEnabled);
+    }
+    
+    // This moves the engines to the host's rate and resets everything
+    updateOversampling (chain, stages, filter);
+    updateChorusParameters (chain, true);
+    resetChain (chain);
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::allocateChain (ProcessingChain<SampleType>& chain, const juce::dsp::ProcessSpec& spec, int stages, int filter)
+{
+    // Anything built for the old spec is dropped, and of the oversamplers
+    // only the one in use is built again
+    for (int i = 0; i < maxOversamplingStages; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            chain.oversamplers[i][j].store (nullptr, std::memory_order_relaxed);
+            chain.ownedOversamplers[i][j].reset();
+        }
+    }
+    
+    delete chain.grownChorus.exchange (nullptr);
+    chain.allocatedSpec = spec;
+    
+    if (stages > 0)
+        createOversampler (chain, stages, filter);
     
-    chorus.prepare (spec);
-    chorus.reset();
+    for (int i = 0; i < 2; ++i)
+    {
+        chain.choruses[i] = createChorus<SampleType> (spec, stages);
+        chain.chorusStages[i] = stages;
+    }
+    
+    chain.crossfadeBuffer.setSize (2 * (int) spec.numChannels, (int) spec.maximumBlockSize);
+}
+
+template <typename SampleType>
+std::unique_ptr<ChorusEngine<SampleType>> BasicChorusAudioProcessor::createChorus (const juce::dsp::ProcessSpec& spec, int stages) const
+{
+    auto oversampledSpec = spec;
+    oversampledSpec.sampleRate *= (double) (1 << stages);
+    oversampledSpec.maximumBlockSize *= (juce::uint32) (1 << stages);
+    
+    // The delay lines only need to reach as far as the parameter ranges allow
+    auto chorus = std::make_unique<ChorusEngine<SampleType>>();
+    chorus->setMaximumDelay (getMaximumDelayMs());
+    chorus->setRampLength (parameterRampLength);
+    chorus->prepare (oversampledSpec);
+    return chorus;
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::createOversampler (ProcessingChain<SampleType>& chain, int stages, int filter)
+{
+    using Oversampling = juce::dsp::Oversampling<SampleType>;
+    
+    auto& oversampler = chain.ownedOversamplers[stages - 1][filter];
+    
+    if (oversampler != nullptr)
+        return;
+    
+    // Filter 0 is the minimum phase IIR, filter 1 the linear phase FIR
+    const typename Oversampling::FilterType filterTypes[] { Oversampling::filterHalfBandPolyphaseIIR,
+                                                            Oversampling::filterHalfBandFIREquiripple };
+    
+    const auto& spec = chain.allocatedSpec;
+    oversampler = std::make_unique<Oversampling> (spec.numChannels, (size_t) stages, filterTypes[filter], true, true);
+    oversampler->initProcessing ((size_t) spec.maximumBlockSize);
+    chain.oversamplers[stages - 1][filter].store (oversampler.get(), std::memory_order_release);
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::growChain (ProcessingChain<SampleType>& chain)
+{
+    const juce::ScopedLock lock (chainLock);
+    
+    // An engine the audio thread has swapped out is freed here, off its thread
+    delete chain.retiredChorus.exchange (nullptr, std::memory_order_acquire);
+    
+    if (chain.allocatedSpec.numChannels == 0)
+        return;
+    
+    const auto oversamplerIndex = chain.requestedOversampler.exchange (-1, std::memory_order_relaxed);
+    
+    if (oversamplerIndex >= 0)
+        createOversampler (chain, oversamplerIndex / 2 + 1, oversamplerIndex % 2);
+    
+    // One engine at a time; a request made meanwhile is repeated every block
+    const auto stages = chain.requestedChorusStages.exchange (0, std::memory_order_relaxed);
+    
+    if (stages > 0 && chain.grownChorus.load (std::memory_order_relaxed) == nullptr)
+    {
+        chain.grownChorusStages.store (stages, std::memory_order_relaxed);
+        chain.grownChorus.store (createChorus<SampleType> (chain.allocatedSpec, stages).release(), std::memory_order_release);
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::releaseChain (ProcessingChain<SampleType>& chain)
+{
+    const juce::ScopedLock lock (chainLock);
+    
+    if (chain.allocatedSpec.numChannels == 0)
+        return;
+    
+    chain.activeOversampler = chain.fadingOversampler = nullptr;
+    chain.activeChorus = chain.fadingChorus = nullptr;
+    chain.isCrossfadingPaths = false;
+    chain.crossfadeBuffer.setSize (0, 0);
+    chain.allocatedSpec = {};
+    
+    for (int i = 0; i < maxOversamplingStages; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            chain.oversamplers[i][j].store (nullptr, std::memory_order_relaxed);
+            chain.ownedOversamplers[i][j].reset();
+        }
+    }
+    
+    for (int i = 0; i < 2; ++i)
+    {
+        chain.choruses[i].reset();
+        chain.chorusStages[i] = 0;
+    }
+    
+    delete chain.grownChorus.exchange (nullptr);
+    delete chain.retiredChorus.exchange (nullptr);
+    chain.requestedOversampler = -1;
+    chain.requestedChorusStages = 0;
+}
+
+void BasicChorusAudioProcessor::setParameterRampLength (double newRampLengthSeconds)
+{
+    jassert (newRampLengthSeconds >= 0.0);
+    parameterRampLength = newRampLengthSeconds;
+}
+
+void BasicChorusAudioProcessor::setMaximumProcessingSpec (double newMaximumSampleRate, int newMaximumBlockSize)
+{
+    jassert (newMaximumSampleRate >= 0.0 && newMaximumBlockSize >= 0);
+    maximumSampleRate = newMaximumSampleRate;
+    maximumBlockSize = newMaximumBlockSize;
+}
+
+void BasicChorusAudioProcessor::setFreeMemoryOnRelease (bool shouldFreeMemory)
+{
+    freeMemoryOnRelease = shouldFreeMemory;
 }
 
 void BasicChorusAudioProcessor::releaseResources()
 {
-    // When playback stops, you can use this as an opportunity to free up any
-    // spare memory, etc.
+    // Hosts call this whenever playback stops, so by default everything is
+    // kept for the next prepareToPlay.
+    if (! freeMemoryOnRelease)
+        return;
+    
+    releaseChain (floatChain);
+    releaseChain (doubleChain);
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -124,15 +411,16 @@ bool BasicChorusAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Any layout of up to maxChannels works, as every channel has its own
+    // delay line; wide layouts are processed in groups of channels.
+    const auto& outputs = layouts.getMainOutputChannelSet();
+    
+    if (outputs.isDisabled() || outputs.size() > ChorusEngineBase::maxChannels)
         return false;
 
     // This checks if the input layout matches the output layout
    #if ! JucePlugin_IsSynth
-    if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
+    if (outputs != layouts.getMainInputChannelSet())
         return false;
    #endif
 
@@ -142,6 +430,52 @@ bool BasicChorusAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
 #endif
 
 void BasicChorusAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    jassert (! isUsingDoublePrecision());
+    const ProcessTimer::ScopedMeasurement measurement (processTimer, buffer.getNumSamples());
+    process (buffer, floatChain);
+}
+
+void BasicChorusAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    jassert (isUsingDoublePrecision());
+    const ProcessTimer::ScopedMeasurement measurement (processTimer, buffer.getNumSamples());
+    process (buffer, doubleChain);
+}
+
+bool BasicChorusAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+ProcessTimer::Statistics BasicChorusAudioProcessor::getProcessingStatistics() const noexcept
+{
+    return processTimer.getStatistics();
+}
+
+void BasicChorusAudioProcessor::setScopeEnabled (bool shouldCapture)
+{
+    // Once made, the queue is kept, so the audio thread can use it whenever
+    // it sees the flag set.
+    if (shouldCapture && scopeQueue == nullptr)
+        scopeQueue = std::make_unique<ScopeQueue> (256);
+    
+    scopeEnabled.store (shouldCapture, std::memory_order_release);
+}
+
+bool BasicChorusAudioProcessor::popScopeSnapshot (ScopeSnapshot& snapshot) noexcept
+{
+    return scopeQueue != nullptr && scopeQueue->pop (snapshot);
+}
+
+float BasicChorusAudioProcessor::getMaximumDelayMs() const
+{
+    return apvts.getParameterRange ("CENTREDELAY").end
+             + apvts.getParameterRange ("DEPTH").end * ChorusEngineBase::maxDepthMs;
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::process (juce::AudioBuffer<SampleType>& buffer, ProcessingChain<SampleType>& chain) noexcept
 {
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -150,8 +484,327 @@ void BasicChorusAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    juce::dsp::AudioBlock<float> sampleBlock (buffer);
-    chorus.process (juce::dsp::ProcessContextReplacing<float> (sampleBlock));
+    // The offline profile is switched between blocks; the interpolation and LFO
+    // precision both carry their state across, so the change is seamless.
+    const auto shouldUseOfflineQuality = isNonRealtime();
+    
+    if (shouldUseOfflineQuality != offlineQualityEnabled)
+    {
+        offlineQualityEnabled = shouldUseOfflineQuality;
+        chain.activeChorus->setInterpolation (getEffectiveInterpolation (appliedParameters.interpolation));
+        
+        for (auto& chorus : chain.choruses)
+            chorus->setHighPrecisionLfo (offlineQualityEnabled);
+    }
+    
+    updateChorusParameters (chain, false);
+    
+    if (isInputSilent (buffer))
+    {
+        // Once the feedback tail has died away there is nothing left to do
+        // until the input comes back.
+        if (isIdle)
+        {
+            applyPendingParameterEvents (chain);
+            buffer.clear();
+            return;
+        }
+        
+        silentSamplesSeen += buffer.getNumSamples();
+        
+        const auto tailSeconds = calculateTailSeconds (appliedParameters.centreDelay, appliedParameters.depth, appliedParameters.feedback);
+        // The latency reported to the host can lag a change of oversampling
+        const auto tailSamples = tailSeconds * preparedSampleRate + (double) pathLatencySamples;
+        
+        if ((double) silentSamplesSeen > tailSamples)
+        {
+            applyPendingParameterEvents (chain);
+            isIdle = true;
+            buffer.clear();
+            return;
+        }
+    }
+    else
+    {
+        if (isIdle)
+            resetChain (chain);
+        
+        isIdle = false;
+        silentSamplesSeen = 0;
+    }
+    
+    const auto shouldCaptureScope = scopeEnabled.load (std::memory_order_acquire);
+    
+    // The engines only track their wet peak while the scope reads it
+    for (auto& chorus : chain.choruses)
+        chorus->setWetPeakTracking (shouldCaptureScope);
+    
+    if (shouldCaptureScope)
+        scopeDryPeak = juce::jmax (scopeDryPeak, (float) buffer.getMagnitude (0, buffer.getNumSamples()));
+    
+    juce::dsp::AudioBlock<SampleType> sampleBlock (buffer);
+    processWithParameterEvents (chain, sampleBlock);
+    
+    // While idle nothing is captured, so the scope holds its last reading
+    if (shouldCaptureScope)
+        pushScopeSnapshot (chain, buffer.getNumSamples());
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::pushScopeSnapshot (ProcessingChain<SampleType>& chain, int numSamples) noexcept
+{
+    auto& chorus = *chain.activeChorus;
+    scopeWetPeak = juce::jmax (scopeWetPeak, (float) chorus.getWetPeak());
+    chorus.resetWetPeak();
+    
+    scopeSamplesSincePush += numSamples;
+    
+    if (scopeSamplesSincePush < juce::roundToInt (scopeIntervalSeconds * preparedSampleRate))
+        return;
+    
+    scopeQueue->push ({ chorus.getModulatedDelayMs(), scopeDryPeak, scopeWetPeak });
+    scopeSamplesSincePush = 0;
+    scopeDryPeak = scopeWetPeak = 0.0f;
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::processChorus (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    if (chain.isCrossfadingPaths)
+    {
+        processPaths (chain, block);
+        return;
+    }
+    
+    if (auto* oversampler = chain.activeOversampler)
+    {
+        auto oversampledBlock = oversampler->processSamplesUp (block);
+        processEngines (chain, oversampledBlock);
+        oversampler->processSamplesDown (block);
+    }
+    else
+    {
+        processEngines (chain, block);
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::processEngines (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    size_t position = 0;
+    
+    while (position < numSamples && chain.fadingChorus != nullptr)
+    {
+        const auto chunkSize = juce::jmin (numSamples - position,
+                                           (size_t) (chain.crossfadeLength - chain.crossfadePosition),
+                                           (size_t) chain.crossfadeBuffer.getNumSamples());
+        
+        auto chunk = block.getSubBlock (position, chunkSize);
+        
+        juce::dsp::AudioBlock<SampleType> scratch (chain.crossfadeBuffer);
+        auto dry   = scratch.getSubsetChannelBlock (0, numChannels).getSubBlock (0, chunkSize);
+        auto faded = scratch.getSubsetChannelBlock (numChannels, numChannels).getSubBlock (0, chunkSize);
+        dry.copyFrom (chunk);
+        faded.copyFrom (chunk);
+        
+        chain.fadingChorus->process (juce::dsp::ProcessContextReplacing<SampleType> (faded));
+        chain.activeChorus->process (juce::dsp::ProcessContextReplacing<SampleType> (chunk));
+        
+        mixCrossfade (chain, dry, faded, chunk);
+        position += chunkSize;
+    }
+    
+    if (position < numSamples)
+    {
+        auto rest = block.getSubBlock (position);
+        chain.activeChorus->process (juce::dsp::ProcessContextReplacing<SampleType> (rest));
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::processPaths (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    // Each engine runs inside its own oversampler, and the two outputs are
+    // crossfaded at the host's rate.
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    size_t position = 0;
+    
+    while (position < numSamples && chain.isCrossfadingPaths)
+    {
+        const auto chunkSize = juce::jmin (numSamples - position,
+                                           (size_t) (chain.crossfadeLength - chain.crossfadePosition),
+                                           (size_t) chain.crossfadeBuffer.getNumSamples());
+        
+        auto chunk = block.getSubBlock (position, chunkSize);
+        
+        juce::dsp::AudioBlock<SampleType> scratch (chain.crossfadeBuffer);
+        auto dry   = scratch.getSubsetChannelBlock (0, numChannels).getSubBlock (0, chunkSize);
+        auto faded = scratch.getSubsetChannelBlock (numChannels, numChannels).getSubBlock (0, chunkSize);
+        dry.copyFrom (chunk);
+        faded.copyFrom (chunk);
+        
+        processPath (chain.fadingOversampler, *chain.fadingChorus, faded);
+        processPath (chain.activeOversampler, *chain.activeChorus, chunk);
+        
+        mixCrossfade (chain, dry, faded, chunk);
+        position += chunkSize;
+    }
+    
+    if (position < numSamples)
+    {
+        auto rest = block.getSubBlock (position);
+        processPath (chain.activeOversampler, *chain.activeChorus, rest);
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::processPath (juce::dsp::Oversampling<SampleType>* oversampler, ChorusEngine<SampleType>& chorus,
+                                             juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    if (oversampler != nullptr)
+    {
+        auto oversampledBlock = oversampler->processSamplesUp (block);
+        chorus.process (juce::dsp::ProcessContextReplacing<SampleType> (oversampledBlock));
+        oversampler->processSamplesDown (block);
+    }
+    else
+    {
+        chorus.process (juce::dsp::ProcessContextReplacing<SampleType> (block));
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::mixCrossfade (ProcessingChain<SampleType>& chain, const juce::dsp::AudioBlock<SampleType>& dry,
+                                              const juce::dsp::AudioBlock<SampleType>& faded, juce::dsp::AudioBlock<SampleType>& output) noexcept
+{
+    const auto numChannels = output.getNumChannels();
+    const auto numSamples = output.getNumSamples();
+    
+    // Both outputs hold the same dry signal, so the equal-power curves are
+    // applied to what each engine adds to it, and the dry level stays put.
+    const auto angleStep = juce::MathConstants<double>::halfPi / (double) chain.crossfadeLength;
+    
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        const auto angle = angleStep * (double) (chain.crossfadePosition + (int) i + 1);
+        const auto fadeIn = (SampleType) std::sin (angle);
+        const auto fadeOut = (SampleType) std::cos (angle);
+        
+        for (size_t channel = 0; channel < numChannels; ++channel)
+        {
+            const auto input = dry.getSample ((int) channel, (int) i);
+            auto* samples = output.getChannelPointer (channel);
+            
+            samples[i] = input + fadeIn * (samples[i] - input) + fadeOut * (faded.getSample ((int) channel, (int) i) - input);
+        }
+    }
+    
+    chain.crossfadePosition += (int) numSamples;
+    
+    if (chain.crossfadePosition >= chain.crossfadeLength)
+    {
+        chain.fadingChorus = nullptr;
+        chain.fadingOversampler = nullptr;
+        chain.isCrossfadingPaths = false;
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::startCrossfade (ProcessingChain<SampleType>& chain, int stages, int filter) noexcept
+{
+    auto* previous = chain.activeChorus;
+    chain.activeChorus = previous == chain.choruses[0].get() ? chain.choruses[1].get() : chain.choruses[0].get();
+    chain.fadingChorus = previous;
+    chain.isCrossfadingPaths = changesOversamplingPath (stages, filter);
+    
+    if (chain.isCrossfadingPaths)
+    {
+        // The old oversampler keeps running for the fading engine, and the new
+        // one starts clean. The timer tells the host about the latency, as it
+        // mustn't be called back from this thread.
+        chain.fadingOversampler = chain.activeOversampler;
+        chain.activeOversampler = stages > 0 ? chain.oversamplers[stages - 1][filter].load (std::memory_order_acquire) : nullptr;
+        activeOversamplingStages = stages;
+        activeOversamplingFilter = filter;
+        
+        auto* oversampler = chain.activeOversampler;
+        
+        if (oversampler != nullptr)
+            oversampler->reset();
+        
+        const auto newLatency = oversampler != nullptr ? juce::roundToInt (oversampler->getLatencyInSamples()) : 0;
+        
+        if (newLatency != pathLatencySamples)
+            pendingLatencySamples = pathLatencySamples = newLatency;
+    }
+    
+    // The standby engine may have been left at the rate of an earlier path
+    const auto chorusSampleRate = preparedSampleRate * (double) (1 << juce::jmax (0, activeOversamplingStages));
+    chain.activeChorus->setSampleRate (chorusSampleRate);
+    
+    // Engines are crossfaded at their own rate, and paths at the host's
+    const auto fadeSampleRate = chain.isCrossfadingPaths ? preparedSampleRate : chorusSampleRate;
+    chain.crossfadeLength = juce::jmax (1, juce::roundToInt (crossfadeSeconds * fadeSampleRate));
+    chain.crossfadePosition = 0;
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::updateStandbyChorus (ProcessingChain<SampleType>& chain) noexcept
+{
+    // Only called between crossfades, while the standby engine isn't running.
+    // A larger engine isn't taken until the last one swapped out has been freed.
+    const auto standby = chain.activeChorus == chain.choruses[0].get() ? 1 : 0;
+    
+    if (chain.retiredChorus.load (std::memory_order_acquire) == nullptr)
+    {
+        if (auto* grown = chain.grownChorus.exchange (nullptr, std::memory_order_acquire))
+        {
+            grown->setHighPrecisionLfo (offlineQualityEnabled);
+            chain.retiredChorus.store (chain.choruses[standby].release(), std::memory_order_release);
+            chain.choruses[standby].reset (grown);
+            chain.chorusStages[standby] = chain.grownChorusStages.load (std::memory_order_relaxed);
+        }
+    }
+    
+    // After a switch to more oversampling, the engine that was faded out is
+    // grown too, so that the next crossfade doesn't have to wait for it.
+    if (chain.chorusStages[standby] < activeOversamplingStages)
+        chain.requestedChorusStages.store (activeOversamplingStages, std::memory_order_relaxed);
+}
+
+template <typename SampleType>
+bool BasicChorusAudioProcessor::isReadyFor (ProcessingChain<SampleType>& chain, int stages, int filter) noexcept
+{
+    // Whatever the standby path is missing is asked for from the timer
+    const auto standby = chain.activeChorus == chain.choruses[0].get() ? 1 : 0;
+    auto isReady = true;
+    
+    if (chain.chorusStages[standby] < stages)
+    {
+        chain.requestedChorusStages.store (stages, std::memory_order_relaxed);
+        isReady = false;
+    }
+    
+    if (stages > 0 && chain.oversamplers[stages - 1][filter].load (std::memory_order_acquire) == nullptr)
+    {
+        chain.requestedOversampler.store ((stages - 1) * 2 + filter, std::memory_order_relaxed);
+        isReady = false;
+    }
+    
+    return isReady;
+}
+
+template <typename SampleType>
+bool BasicChorusAudioProcessor::isInputSilent (const juce::AudioBuffer<SampleType>& buffer) const noexcept
+{
+    for (int channel = 0; channel < getTotalNumInputChannels(); ++channel)
+        if (buffer.getMagnitude (channel, 0, buffer.getNumSamples()) > (SampleType) silenceThreshold)
+            return false;
+    
+    return true;
 }
 
 //==============================================================================
@@ -162,22 +815,66 @@ bool BasicChorusAudioProcessor::hasEditor() const
 
 juce::AudioProcessorEditor* BasicChorusAudioProcessor::createEditor()
 {
+    const StartupProfile::ScopedStage stage (startupProfile, StartupProfile::Stage::createEditor);
     return new BasicChorusAudioProcessorEditor (*this);
 }
 
 //==============================================================================
 void BasicChorusAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    juce::ValueTree copyState = apvts.copyState();
-    std::unique_ptr<juce::XmlElement> xml = copyState.createXml();
-    copyXmlToBinary (*xml.get(), destData);
+    float values[StateFormat::numParameters];
+    
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+        values[i] = stateParameters[i]->convertFrom0to1 (stateParameters[i]->getValue());
+    
+    StateFormat::Writer writer (destData, values, StateFormat::numParameters);
+    
+    // The program number is kept so the host shows the same program on recall
+    const auto program = juce::ByteOrder::swapIfBigEndian ((juce::uint32) currentProgram.load());
+    writer.addChunk (programChunkId, &program, (int) sizeof (program));
 }
 
 void BasicChorusAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
+    // A program switched to before this state mustn't be applied after it
+    pendingProgram = -1;
+    
+    if (StateFormat::hasBinaryHeader (data, sizeInBytes))
+    {
+        const StateFormat::Reader reader (data, sizeInBytes);
+        
+        if (! reader.isValid())
+        {
+            jassertfalse; // the state is corrupt, so the current settings are kept
+            return;
+        }
+        
+        float values[StateFormat::numParameters];
+        const auto numValues = juce::jmin (reader.getNumParameterValues(), StateFormat::numParameters);
+        
+        for (int i = 0; i < numValues; ++i)
+            values[i] = reader.getParameterValue (i);
+        
+        applyParameterValues (values, numValues);
+        
+        int programSize = 0;
+        
+        if (const auto* program = reader.findChunk (programChunkId, programSize))
+            if (programSize == (int) sizeof (juce::uint32))
+                currentProgram = juce::jlimit (0, getNumPrograms() - 1, (int) juce::ByteOrder::littleEndianInt (program));
+        
+        return;
+    }
+    
+    // Sessions saved before the binary format hold the parameters as XML
     std::unique_ptr<juce::XmlElement> xml = getXmlFromBinary (data, sizeInBytes);
-    juce::ValueTree copyState = juce::ValueTree::fromXml (*xml.get());
-    apvts.replaceState (copyState);
+    
+    if (xml != nullptr && xml->hasTagName (apvts.state.getType()))
+    {
+        beginParameterChange();
+        apvts.replaceState (juce::ValueTree::fromXml (*xml));
+        endParameterChange();
+    }
 }
 
 //==============================================================================
@@ -189,38 +886,426 @@ juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 
 void BasicChorusAudioProcessor::reset()
 {
-    chorus.reset();
+    resetChain (floatChain);
+    resetChain (doubleChain);
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::resetChain (ProcessingChain<SampleType>& chain) noexcept
+{
+    for (auto& chorus : chain.choruses)
+        if (chorus != nullptr)
+            chorus->reset();
+    
+    chain.fadingChorus = nullptr;
+    chain.fadingOversampler = nullptr;
+    chain.isCrossfadingPaths = false;
+    
+    if (chain.activeOversampler != nullptr)
+        chain.activeOversampler->reset();
+}
+
+void BasicChorusAudioProcessor::applyParameterValues (const float* values, int numValues)
+{
+    beginParameterChange();
+    
+    // Values are set straight on the parameters, so recall doesn't build a
+    // ValueTree; anything not given goes back to its default.
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+    {
+        auto* parameter = stateParameters[i];
+        const auto newValue = getNormalisedValue (i, values, numValues);
+        
+        if (newValue != parameter->getValue())
+            parameter->setValueNotifyingHost (newValue);
+    }
+    
+    endParameterChange();
+}
+
+void BasicChorusAudioProcessor::beginParameterChange() noexcept
+{
+    // An odd sequence tells the audio thread that a change is being written,
+    // so it holds everything as it is rather than picking up part of it.
+    parameterSequence.store (parameterSequence.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+}
+
+void BasicChorusAudioProcessor::endParameterChange() noexcept
+{
+    // The whole change is published as one snapshot, which the audio thread
+    // crossfades to once the sequence is even again.
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+        targetValues[i].store (stateValues[i]->load (std::memory_order_relaxed), std::memory_order_relaxed);
+    
+    parameterSequence.store (parameterSequence.load (std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+float BasicChorusAudioProcessor::getNormalisedValue (int parameterIndex, const float* values, int numValues) const
+{
+    auto* parameter = stateParameters[parameterIndex];
+    
+    return parameterIndex < numValues ? parameter->convertTo0to1 (values[parameterIndex])
+                                      : parameter->getDefaultValue();
+}
+
+void BasicChorusAudioProcessor::loadUserBank()
+{
+    if (userBankLoaded.load (std::memory_order_acquire))
+        return;
+    
+    // Whichever call comes first loads it, and any other waits for it to finish
+    const juce::ScopedLock lock (userBankLock);
+    
+    if (! userBankLoaded.load (std::memory_order_relaxed))
+    {
+        presetBank.addBankFile (PresetBank::getUserBankFile());
+        userBankLoaded.store (true, std::memory_order_release);
+    }
 }
 
-void BasicChorusAudioProcessor::parameterChanged (const juce::String& parameterID, float newValue)
+BasicChorusAudioProcessor::ChorusParameters BasicChorusAudioProcessor::getPresetParameters (int index) const noexcept
 {
-    if (parameterID == "RATE")
-        chorus.setRate (newValue);
+    const auto& preset = presetBank.getPreset (index);
+    float values[StateFormat::numParameters];
+    
+    // Snapped the same way as the parameters will be once they're synced
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+        values[i] = stateParameters[i]->convertFrom0to1 (getNormalisedValue (i, preset.values, preset.numValues));
+    
+    return makeParameters (values);
+}
+
+void BasicChorusAudioProcessor::timerCallback()
+{
+    // Only the chain that's been prepared has anything to grow
+    growChain (floatChain);
+    growChain (doubleChain);
+    
+    const auto latency = pendingLatencySamples.exchange (-1);
     
-    if (parameterID == "DEPTH")
-        chorus.setDepth (newValue);
+    if (latency >= 0)
+        setLatencySamples (latency);
     
-    if (parameterID == "CENTREDELAY")
-        chorus.setCentreDelay (newValue);
+    auto sync = programToSync.load (std::memory_order_acquire);
     
-    if (parameterID == "FEEDBACK")
-        chorus.setFeedback (newValue);
+    if (sync < 0)
+        return;
     
-    if (parameterID == "MIX")
-        chorus.setMix (newValue);
+    // The processing already has the program's values, so this only brings the
+    // parameters and the host in line, which doesn't start another crossfade.
+    // A state set since the program was taken up replaces it, so it's dropped.
+    if ((juce::uint32) (sync >> 32) == (parameterSequence.load (std::memory_order_acquire) & 0x7fffffff))
+    {
+        const auto& preset = presetBank.getPreset ((int) (sync & 0xffffffff));
+        
+        for (int i = 0; i < StateFormat::numParameters; ++i)
+        {
+            auto* parameter = stateParameters[i];
+            const auto newValue = getNormalisedValue (i, preset.values, preset.numValues);
+            
+            if (newValue != parameter->getValue())
+                parameter->setValueNotifyingHost (newValue);
+        }
+    }
+    
+    // Cleared only once the parameters match, as until then the audio thread
+    // ignores them; a program taken up meanwhile is synced on the next tick.
+    programToSync.compare_exchange_strong (sync, -1, std::memory_order_release);
+}
+
+BasicChorusAudioProcessor::ChorusParameters BasicChorusAudioProcessor::loadParameters() const noexcept
+{
+    float values[StateFormat::numParameters];
+    
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+        values[i] = stateValues[i]->load (std::memory_order_relaxed);
+    
+    return makeParameters (values);
+}
+
+BasicChorusAudioProcessor::ChorusParameters BasicChorusAudioProcessor::loadTargetParameters() const noexcept
+{
+    float values[StateFormat::numParameters];
+    
+    for (int i = 0; i < StateFormat::numParameters; ++i)
+        values[i] = targetValues[i].load (std::memory_order_relaxed);
+    
+    return makeParameters (values);
+}
+
+BasicChorusAudioProcessor::ChorusParameters BasicChorusAudioProcessor::makeParameters (const float* values) noexcept
+{
+    // The values are in the order of StateFormat::parameterIds
+    static_assert (StateFormat::numParameters == 11, "A new parameter needs adding to ChorusParameters");
+    
+    return { values[0], values[1], values[2], values[3], values[4],
+             (int) values[5], (int) values[6], (int) values[7], (int) values[8], (int) values[9],
+             values[10] };
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::updateChorusParameters (ProcessingChain<SampleType>& chain, bool forceUpdate) noexcept
+{
+    // Called once per block on the audio thread; the chorus is only touched
+    // for the values the host has actually moved since the last block. Values
+    // set by parameter events stay in place until the host changes them.
+    //
+    // While a crossfade runs or a state is being written nothing is read, so
+    // changes that arrive meanwhile reach neither hostParameters nor the
+    // engine until they can be acted on together.
+    const auto sequence = parameterSequence.load (std::memory_order_acquire);
+    
+    if (! forceUpdate && (chain.fadingChorus != nullptr || (sequence & 1) != 0))
+        return;
+    
+    if (! forceUpdate)
+        updateStandbyChorus (chain);
+    
+    const auto isNewState = ! forceUpdate && sequence != appliedSequence;
+    auto newParameters = isNewState ? loadTargetParameters() : loadParameters();
+    
+    // A change that began while the values were being read may have left
+    // them half written, so they're read again next block.
+    std::atomic_thread_fence (std::memory_order_acquire);
+    
+    if (! forceUpdate && parameterSequence.load (std::memory_order_relaxed) != sequence)
+        return;
+    
+    // A program switched off the message thread arrives as an index, and its
+    // values are taken from the bank. Until the timer has synced the
+    // parameters to it, they're out of date, so they're ignored.
+    auto program = -1;
+    
+    if (! forceUpdate && ! isNewState)
+    {
+        program = pendingProgram.load (std::memory_order_acquire);
+        
+        if (program >= 0)
+            newParameters = getPresetParameters (program);
+        else if (programToSync.load (std::memory_order_acquire) >= 0)
+            newParameters = hostParameters;
+    }
+    
+    const auto isNewProgram = program >= 0;
+    const auto newStages = juce::jmax (newParameters.oversampling, preparedForOffline ? 1 : 0);
+    const auto newFilter = newParameters.oversamplingFilter;
+    const auto previousStages = activeOversamplingStages;
+    
+    // A new state or program, a change of oversampling or a big jump in centre
+    // delay would click or sweep the pitch if glided to, so the standby engine
+    // is given all of the new settings and crossfaded in. So would a change in
+    // the number of voices, which moves every voice's phase and gain, the LFO
+    // shape, which reads a different table, or the interpolation, which clears
+    // the allpass states; none of those can be ramped.
+    //
+    // When preparing, the oversampling has already been set up.
+    const auto shouldCrossfade = ! forceUpdate
+                                  && (isNewState || isNewProgram
+                                       || changesOversamplingPath (newStages, newFilter)
+                                       || newParameters.numVoices != hostParameters.numVoices
+                                       || newParameters.lfoShape != hostParameters.lfoShape
+                                       || newParameters.interpolation != hostParameters.interpolation
+                                       || std::abs (newParameters.centreDelay - hostParameters.centreDelay) > maxGlideDelayMs);
+    
+    // Nothing is allocated here: if the new path needs an oversampler or a
+    // larger engine, the timer is asked for it, and until it's ready nothing
+    // is taken up, so the whole change is applied together afterwards.
+    if (shouldCrossfade && ! isReadyFor (chain, newStages, newFilter))
+        return;
+    
+    appliedSequence = sequence;
+    
+    if (isNewProgram)
+    {
+        // A program switched to since it was read is left for the next block
+        auto expected = program;
+        pendingProgram.compare_exchange_strong (expected, -1, std::memory_order_relaxed);
+        programToSync.store (((juce::int64) (sequence & 0x7fffffff) << 32) | program, std::memory_order_release);
+    }
+    
+    if (shouldCrossfade)
+    {
+        startCrossfade (chain, newStages, newFilter);
+        forceUpdate = true;
+    }
+    
+    auto& chorus = *chain.activeChorus;
+    
+    const auto hasChanged = [&] (auto ChorusParameters::* member)
+    {
+        if (! forceUpdate && newParameters.*member == hostParameters.*member)
+            return false;
+        
+        appliedParameters.*member = newParameters.*member;
+        return true;
+    };
+    
+    if (hasChanged (&ChorusParameters::rate))
+        chorus.setRate (newParameters.rate);
+    
+    if (hasChanged (&ChorusParameters::depth))
+        chorus.setDepth (newParameters.depth);
+    
+    if (hasChanged (&ChorusParameters::centreDelay))
+        chorus.setCentreDelay (newParameters.centreDelay);
+    
+    if (hasChanged (&ChorusParameters::feedback))
+        chorus.setFeedback (newParameters.feedback);
+    
+    if (hasChanged (&ChorusParameters::mix))
+        chorus.setMix (newParameters.mix);
+    
+    if (hasChanged (&ChorusParameters::numVoices))
+        chorus.setNumVoices (newParameters.numVoices);
+    
+    if (hasChanged (&ChorusParameters::lfoShape))
+        chorus.setLfoShape (static_cast<ChorusLfo::Shape> (newParameters.lfoShape));
+    
+    if (hasChanged (&ChorusParameters::interpolation))
+        chorus.setInterpolation (getEffectiveInterpolation (newParameters.interpolation));
+    
+    if (hasChanged (&ChorusParameters::channelSpread))
+        chorus.setChannelSpread (newParameters.channelSpread);
+    
+    hostParameters = newParameters;
+    
+    if (! shouldCrossfade)
+        return;
+    
+    // The old delay lines can only be taken over at the same rate; at a new
+    // one the engine starts empty, and its wet signal builds up as the old
+    // engine fades out.
+    if (activeOversamplingStages == previousStages)
+    {
+        chorus.continueFrom (*chain.fadingChorus);
+    }
+    else
+    {
+        chorus.reset();
+        chorus.continueModulationFrom (*chain.fadingChorus);
+    }
+}
+
+//==============================================================================
+bool BasicChorusAudioProcessor::addParameterEvent (EventParameter parameter, int sampleOffset, float newValue) noexcept
+{
+    jassert (sampleOffset >= 0);
+    return parameterEvents != nullptr && parameterEvents->push ({ juce::jmax (0, sampleOffset), (int) parameter, newValue });
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::applyParameterEvent (ProcessingChain<SampleType>& chain, const ParameterEvent& event) noexcept
+{
+    switch (static_cast<EventParameter> (event.parameter))
+    {
+        case EventParameter::rate:          chain.activeChorus->setRate (appliedParameters.rate = event.value); break;
+        case EventParameter::depth:         chain.activeChorus->setDepth (appliedParameters.depth = event.value); break;
+        case EventParameter::centreDelay:   chain.activeChorus->setCentreDelay (appliedParameters.centreDelay = event.value); break;
+        case EventParameter::feedback:      chain.activeChorus->setFeedback (appliedParameters.feedback = event.value); break;
+        case EventParameter::mix:           chain.activeChorus->setMix (appliedParameters.mix = event.value); break;
+        default:                            jassertfalse; break;
+    }
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::applyPendingParameterEvents (ProcessingChain<SampleType>& chain) noexcept
+{
+    ParameterEvent event;
+    
+    while (parameterEvents->pop (event))
+        applyParameterEvent (chain, event);
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::processWithParameterEvents (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    const auto numSamples = (int) block.getNumSamples();
+    ParameterEvent event;
+    int position = 0;
+    
+    while (position < numSamples)
+    {
+        // Events closer together than minimumSubBlockSize are applied together,
+        // so that dense automation can't shrink the sub-blocks to nothing.
+        const auto applyLimit = juce::jmin (numSamples, position + minimumSubBlockSize);
+        
+        while (parameterEvents->peek (event) && event.sampleOffset < applyLimit)
+        {
+            applyParameterEvent (chain, event);
+            parameterEvents->pop (event);
+        }
+        
+        auto end = numSamples;
+        
+        if (parameterEvents->peek (event) && event.sampleOffset < numSamples)
+            end = event.sampleOffset;
+        
+        auto subBlock = block.getSubBlock ((size_t) position, (size_t) (end - position));
+        processChorus (chain, subBlock);
+        position = end;
+    }
+    
+    // Anything timed past the end of the block takes effect from the next one
+    applyPendingParameterEvents (chain);
+}
+
+template <typename SampleType>
+void BasicChorusAudioProcessor::updateOversampling (ProcessingChain<SampleType>& chain, int stages, int filter) noexcept
+{
+    // Only called while preparing, so everything starts afresh at the new rate
+    // and the host can be told the latency straight away. While playing, a
+    // change is crossfaded by startCrossfade() instead.
+    activeOversamplingStages = stages;
+    activeOversamplingFilter = filter;
+    chain.activeOversampler = stages > 0 ? chain.oversamplers[stages - 1][filter].load (std::memory_order_acquire) : nullptr;
+    
+    for (auto& chorus : chain.choruses)
+        chorus->setSampleRate (preparedSampleRate * (double) (1 << stages));
+    resetChain (chain);
+    
+    auto* oversampler = chain.activeOversampler;
+    pathLatencySamples = oversampler != nullptr ? juce::roundToInt (oversampler->getLatencyInSamples()) : 0;
+    pendingLatencySamples = -1;
+    setLatencySamples (pathLatencySamples);
+}
+
+bool BasicChorusAudioProcessor::changesOversamplingPath (int stages, int filter) const noexcept
+{
+    // Without oversampling there's no filter in the path, so it can't change
+    return stages != activeOversamplingStages || (stages > 0 && filter != activeOversamplingFilter);
+}
+
+ChorusEngineBase::Interpolation BasicChorusAudioProcessor::getEffectiveInterpolation (int interpolationIndex) const noexcept
+{
+    const auto interpolation = static_cast<ChorusEngineBase::Interpolation> (interpolationIndex);
+    
+    if (offlineQualityEnabled && interpolation == ChorusEngineBase::Interpolation::linear)
+        return ChorusEngineBase::Interpolation::lagrange3rd;
+    
+    return interpolation;
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout BasicChorusAudioProcessor::createParameters()
 {
+    const StartupProfile::ScopedStage stage (startupProfile, StartupProfile::Stage::createParameters);
+    
     juce::AudioProcessorValueTreeState::ParameterLayout params;
     
     using Range = juce::NormalisableRange<float>;
     
+    // New parameters must also be appended to StateFormat::parameterIds
     params.add (std::make_unique<juce::AudioParameterInt>  ("RATE", "Rate", 0, 99, 0));
     params.add (std::make_unique<juce::AudioParameterFloat>("DEPTH", "Depth", Range { 0.0f, 1.0f, 0.01f }, 0.0f));
     params.add (std::make_unique<juce::AudioParameterInt>  ("CENTREDELAY", "Centre Delay", 1, 100, 1));
     params.add (std::make_unique<juce::AudioParameterFloat>("FEEDBACK", "Feedback", Range { -1.0f, 1.0f, 0.01f }, 0.0f));
     params.add (std::make_unique<juce::AudioParameterFloat>("MIX", "Mix", Range { 0.0f, 1.0f, 0.01f }, 0.0f));
+    params.add (std::make_unique<juce::AudioParameterInt>  ("VOICES", "Voices", 1, ChorusEngineBase::maxVoices, 1));
+    params.add (std::make_unique<juce::AudioParameterChoice>("LFOSHAPE", "LFO Shape", juce::StringArray { "Sine", "Triangle", "Random" }, 0));
+    params.add (std::make_unique<juce::AudioParameterChoice>("INTERPOLATION", "Interpolation", juce::StringArray { "Linear", "Lagrange", "Thiran" }, 0));
+    params.add (std::make_unique<juce::AudioParameterChoice>("OVERSAMPLING", "Oversampling", juce::StringArray { "Off", "2x", "4x" }, 0));
+    params.add (std::make_unique<juce::AudioParameterChoice>("OVERSAMPLINGFILTER", "Oversampling Filter", juce::StringArray { "Minimum Phase", "Linear Phase" }, 0));
+    params.add (std::make_unique<juce::AudioParameterFloat>("CHANNELSPREAD", "Channel Spread", Range { 0.0f, 1.0f, 0.01f }, 0.0f));
     
     return params;
 }
@@ -9,12 +9,19 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "ChorusEngine.h"
+#include "ParameterEventQueue.h"
+#include "StateFormat.h"
+#include "PresetBank.h"
+#include "ProcessTimer.h"
+#include "ScopeQueue.h"
+#include "StartupProfile.h"
 
 //==============================================================================
 /**
 */
 class BasicChorusAudioProcessor  : public juce::AudioProcessor,
-                                   public juce::AudioProcessorValueTreeState::Listener
+                                   private juce::Timer
 {
 public:
     //==============================================================================
@@ -30,6 +37,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -55,16 +64,310 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
     void reset() override;
     
+    //==============================================================================
+    /** The parameters that can be moved with sample-accurate events. */
+    enum class EventParameter
+    {
+        rate = 0,
+        depth,
+        centreDelay,
+        feedback,
+        mix
+    };
+    
+    /** Queues a change to a parameter at a sample offset into the next block.
+    
+        The value is in the parameter's own range (e.g. milliseconds for the
+        centre delay). Events must be added in time order by a single thread,
+        and hold until the host next moves the same parameter. Returns false if
+        the queue is full, or if the processor hasn't been prepared yet.
+    */
+    bool addParameterEvent (EventParameter parameter, int sampleOffset, float newValue) noexcept;
+    
+    /** Sets how long parameter changes take to glide to their new value.
+        This takes effect on the next call to prepareToPlay().
+    */
+    void setParameterRampLength (double newRampLengthSeconds);
+    
+    /** The largest change to the centre delay, in milliseconds, that's glided
+        to. A bigger jump is crossfaded onto a second engine instead, as is a
+        new state or program, or a change of oversampling, voices, LFO shape
+        or interpolation.
+    */
+    static constexpr float maxGlideDelayMs = 10.0f;
+    
+    /** Sets the highest sample rate and block size to allocate for. Once the
+        processor has been prepared, later calls to prepareToPlay() with the same
+        channel count and a rate and block size up to these, or up to those of
+        an earlier call, don't allocate. Zero means no more than the host asks for.
+    */
+    void setMaximumProcessingSpec (double newMaximumSampleRate, int newMaximumBlockSize);
+    
+    /** By default releaseResources() keeps everything allocated for the next
+        prepareToPlay(). Pass true to have it free the processing buffers.
+    */
+    void setFreeMemoryOnRelease (bool shouldFreeMemory);
+    
+    /** Timing of every processBlock() call since prepareToPlay(). This can be
+        called from any thread without blocking the audio thread.
+    */
+    ProcessTimer::Statistics getProcessingStatistics() const noexcept;
+    
+    /** The timer itself, for callers that want statistics over their own
+        intervals by comparing snapshots.
+    */
+    const ProcessTimer& getProcessTimer() const noexcept     { return processTimer; }
+    
+    /** Starts or stops capturing readings for the editor's scope. While it's
+        off nothing is captured, and the engines don't track their wet peak.
+    */
+    void setScopeEnabled (bool shouldCapture);
+    
+    /** Takes the oldest scope reading, if there is one. Readings are pushed
+        about every 10 ms of audio. Call this and setScopeEnabled() from the
+        same thread.
+    */
+    bool popScopeSnapshot (ScopeSnapshot& snapshot) noexcept;
+    
+    /** The longest modulated delay that the parameter ranges allow, in ms. */
+    float getMaximumDelayMs() const;
+    
+    /** When construction, the parameters, the first prepareToPlay(), the first
+        editor and its first paint happened, and how long each took.
+    */
+    StartupProfile& getStartupProfile() noexcept                { return startupProfile; }
+    const StartupProfile& getStartupProfile() const noexcept    { return startupProfile; }
+    
+private:
+    // Declared ahead of apvts, which is built by createParameters(), so that
+    // the whole of construction is timed.
+    StartupProfile startupProfile;
+    
+public:
     juce::AudioProcessorValueTreeState apvts;
 
 private:
-    juce::dsp::Chorus<float> chorus;
+    struct ChorusParameters
+    {
+        float rate, depth, centreDelay, feedback, mix;
+        int numVoices, lfoShape, interpolation, oversampling, oversamplingFilter;
+        float channelSpread;
+    };
+    
     juce::AudioProcessorValueTreeState::ParameterLayout createParameters();
     
     juce::AudioPlayHead::CurrentPositionInfo positionInfo;
     int bpm { 0 };
     
-    void parameterChanged (const juce::String& parameterID, float newValue) override;
+    std::atomic<float>* rateParameter               { nullptr };
+    std::atomic<float>* depthParameter              { nullptr };
+    std::atomic<float>* centreDelayParameter        { nullptr };
+    std::atomic<float>* feedbackParameter           { nullptr };
+    std::atomic<float>* mixParameter                { nullptr };
+    std::atomic<float>* voicesParameter             { nullptr };
+    std::atomic<float>* lfoShapeParameter           { nullptr };
+    std::atomic<float>* interpolationParameter      { nullptr };
+    std::atomic<float>* oversamplingParameter       { nullptr };
+    std::atomic<float>* oversamplingFilterParameter { nullptr };
+    std::atomic<float>* channelSpreadParameter      { nullptr };
+    
+    juce::RangedAudioParameter* stateParameters[StateFormat::numParameters] {};
+    std::atomic<float>* stateValues[StateFormat::numParameters] {};
+    
+    // The factory presets are added in the constructor, and the user bank the
+    // first time the programs are asked for, or in prepareToPlay at the latest,
+    // after which the bank is never resized, so programs can be switched from
+    // any thread while processing. A switch off the message thread is passed
+    // to the audio thread as pendingProgram, which crossfades to the preset and
+    // hands it on as programToSync, along with the state sequence it applies
+    // to, for timerCallback() to set the parameters to.
+    PresetBank presetBank;
+    std::atomic<bool> userBankLoaded { false };
+    juce::CriticalSection userBankLock;
+    std::atomic<int> pendingProgram { -1 };
+    std::atomic<juce::int64> programToSync { -1 };
+    std::atomic<int> currentProgram { 0 };
+    static constexpr juce::uint32 programChunkId = StateFormat::makeChunkId ("PROG");
+    
+    ChorusParameters hostParameters {}, appliedParameters {};
+    
+    // Allocated in the first prepareToPlay, as most hosts never queue events
+    std::unique_ptr<ParameterEventQueue> parameterEvents;
+    ProcessTimer processTimer;
+    
+    // The queue is only allocated once an editor first shows the scope
+    std::atomic<bool> scopeEnabled { false };
+    std::unique_ptr<ScopeQueue> scopeQueue;
+    static constexpr double scopeIntervalSeconds = 0.01;
+    int scopeSamplesSincePush { 0 };
+    float scopeDryPeak { 0.0f }, scopeWetPeak { 0.0f };
+    static constexpr int minimumSubBlockSize = 16;
+    
+    // Used while the host renders offline: higher-order interpolation, a
+    // double-precision LFO phase and, if set up in prepareToPlay, at least 2x
+    // oversampling around the chorus.
+    bool offlineQualityEnabled { false };
+    bool preparedForOffline { false };
+    
+    // The engines are sized in prepareToPlay for the oversampling in use, and
+    // only the oversampler for that path is built. Switching to a path the
+    // chain isn't ready for has timerCallback() build what's missing, which
+    // the audio thread picks up from the chain's atomics; until then the
+    // change waits. Oversamplers are indexed by the number of 2x stages minus
+    // one and the filter type.
+    static constexpr int maxOversamplingStages = 2;
+    
+    /** The chorus and oversamplers for one processing precision. Only the chain
+        matching the host's precision is prepared.
+        
+        There are two chorus engines, so that a jump to new settings can be
+        crossfaded rather than glided. Only the active engine runs unless a
+        crossfade is in progress, in which case the other one is fading out.
+        
+        When the oversampling changes, the fading engine keeps running inside
+        its old oversampler, and the two paths are crossfaded at the host's rate.
+    */
+    template <typename SampleType>
+    struct ProcessingChain
+    {
+        ~ProcessingChain()
+        {
+            delete grownChorus.load();
+            delete retiredChorus.load();
+        }
+        
+        // Held by pointer, so that the standby engine can be swapped for one
+        // sized for more oversampling stages than it has room for
+        std::unique_ptr<ChorusEngine<SampleType>> choruses[2];
+        int chorusStages[2] {};
+        ChorusEngine<SampleType>* activeChorus { nullptr };
+        ChorusEngine<SampleType>* fadingChorus { nullptr };
+        
+        // The dry input and the fading engine's output, during a crossfade.
+        // It's sized at the host's rate, so oversampled crossfades use chunks.
+        juce::AudioBuffer<SampleType> crossfadeBuffer;
+        int crossfadePosition { 0 }, crossfadeLength { 0 };
+        bool isCrossfadingPaths { false };
+        
+        // What the buffers are sized for; no channels if nothing is allocated
+        juce::dsp::ProcessSpec allocatedSpec {};
+        
+        // Owned here, and published to the audio thread once each is built
+        std::unique_ptr<juce::dsp::Oversampling<SampleType>> ownedOversamplers[maxOversamplingStages][2];
+        std::atomic<juce::dsp::Oversampling<SampleType>*> oversamplers[maxOversamplingStages][2] {};
+        juce::dsp::Oversampling<SampleType>* activeOversampler { nullptr };
+        juce::dsp::Oversampling<SampleType>* fadingOversampler { nullptr };
+        
+        // What the audio thread is waiting for: an oversampler, as its index
+        // into oversamplers, and an engine with room for a number of stages.
+        // The engine is handed over as grownChorus, and the one it replaces is
+        // handed back as retiredChorus to be freed on the message thread.
+        std::atomic<int> requestedOversampler { -1 }, requestedChorusStages { 0 };
+        std::atomic<ChorusEngine<SampleType>*> grownChorus { nullptr }, retiredChorus { nullptr };
+        std::atomic<int> grownChorusStages { 0 };
+    };
+    
+    ProcessingChain<float> floatChain;
+    ProcessingChain<double> doubleChain;
+    int activeOversamplingStages { -1 }, activeOversamplingFilter { -1 };
+    double preparedSampleRate { 44100.0 };
+    double maximumSampleRate { 0.0 };
+    int maximumBlockSize { 0 };
+    bool freeMemoryOnRelease { false };
+    
+    // Held while a chain is allocated, grown or released, which can happen on
+    // the message thread and on whichever thread the host prepares from
+    juce::CriticalSection chainLock;
+    
+    // Input below this level counts as silence, and the tail is considered
+    // over once the feedback has brought it down to the same level.
+    static constexpr double silenceThreshold = 1.0e-5;
+    
+    // What's reported for feedback at -1 or 1, whose tail never dies away.
+    // Not every plugin wrapper recognises an infinite tail, and those that
+    // convert it to samples as an int would overflow, so it's clamped to an
+    // hour instead, which fits an int at any common sample rate.
+    static constexpr double maxTailSeconds = 3600.0;
+    juce::int64 silentSamplesSeen { 0 };
+    bool isIdle { false };
+    double parameterRampLength { 0.05 };
+    static constexpr double crossfadeSeconds = 0.03;
+    
+    // States and programs are published as a snapshot of every value. The
+    // sequence is odd while one is being written, and the audio thread only
+    // takes a snapshot that was complete and unchanged while it read it. It
+    // assumes one writer at a time, as hosts don't set state concurrently.
+    std::atomic<juce::uint32> parameterSequence { 0 };
+    std::atomic<float> targetValues[StateFormat::numParameters] {};
+    juce::uint32 appliedSequence { 0 };
+    
+    // Set on the audio thread for timerCallback() to tell the host about, only
+    // when the latency of the processing path actually changes
+    std::atomic<int> pendingLatencySamples { -1 };
+    int pathLatencySamples { 0 };
+    
+    ChorusParameters loadParameters() const noexcept;
+    ChorusParameters loadTargetParameters() const noexcept;
+    static ChorusParameters makeParameters (const float* values) noexcept;
+    void beginParameterChange() noexcept;
+    void endParameterChange() noexcept;
+    void applyParameterValues (const float* values, int numValues);
+    float getNormalisedValue (int parameterIndex, const float* values, int numValues) const;
+    ChorusParameters getPresetParameters (int index) const noexcept;
+    void loadUserBank();
+    void timerCallback() override;
+    ChorusEngineBase::Interpolation getEffectiveInterpolation (int interpolationIndex) const noexcept;
+    bool changesOversamplingPath (int stages, int filter) const noexcept;
+    
+    template <typename SampleType>
+    void prepareChain (ProcessingChain<SampleType>& chain, const juce::dsp::ProcessSpec& spec);
+    template <typename SampleType>
+    void allocateChain (ProcessingChain<SampleType>& chain, const juce::dsp::ProcessSpec& spec, int stages, int filter);
+    template <typename SampleType>
+    std::unique_ptr<ChorusEngine<SampleType>> createChorus (const juce::dsp::ProcessSpec& spec, int stages) const;
+    template <typename SampleType>
+    static void createOversampler (ProcessingChain<SampleType>& chain, int stages, int filter);
+    template <typename SampleType>
+    void growChain (ProcessingChain<SampleType>& chain);
+    template <typename SampleType>
+    void updateStandbyChorus (ProcessingChain<SampleType>& chain) noexcept;
+    template <typename SampleType>
+    static bool isReadyFor (ProcessingChain<SampleType>& chain, int stages, int filter) noexcept;
+    template <typename SampleType>
+    void releaseChain (ProcessingChain<SampleType>& chain);
+    template <typename SampleType>
+    void resetChain (ProcessingChain<SampleType>& chain) noexcept;
+    template <typename SampleType>
+    void process (juce::AudioBuffer<SampleType>& buffer, ProcessingChain<SampleType>& chain) noexcept;
+    template <typename SampleType>
+    void updateChorusParameters (ProcessingChain<SampleType>& chain, bool forceUpdate) noexcept;
+    template <typename SampleType>
+    void updateOversampling (ProcessingChain<SampleType>& chain, int stages, int filter) noexcept;
+    template <typename SampleType>
+    void processChorus (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept;
+    template <typename SampleType>
+    void processEngines (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept;
+    template <typename SampleType>
+    void processPaths (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept;
+    template <typename SampleType>
+    static void processPath (juce::dsp::Oversampling<SampleType>* oversampler, ChorusEngine<SampleType>& chorus,
+                             juce::dsp::AudioBlock<SampleType>& block) noexcept;
+    template <typename SampleType>
+    static void mixCrossfade (ProcessingChain<SampleType>& chain, const juce::dsp::AudioBlock<SampleType>& dry,
+                              const juce::dsp::AudioBlock<SampleType>& faded, juce::dsp::AudioBlock<SampleType>& output) noexcept;
+    template <typename SampleType>
+    void startCrossfade (ProcessingChain<SampleType>& chain, int stages, int filter) noexcept;
+    template <typename SampleType>
+    void processWithParameterEvents (ProcessingChain<SampleType>& chain, juce::dsp::AudioBlock<SampleType>& block) noexcept;
+    template <typename SampleType>
+    void applyParameterEvent (ProcessingChain<SampleType>& chain, const ParameterEvent& event) noexcept;
+    template <typename SampleType>
+    void applyPendingParameterEvents (ProcessingChain<SampleType>& chain) noexcept;
+    template <typename SampleType>
+    void pushScopeSnapshot (ProcessingChain<SampleType>& chain, int numSamples) noexcept;
+    template <typename SampleType>
+    bool isInputSilent (const juce::AudioBuffer<SampleType>& buffer) const noexcept;
+    static double calculateTailSeconds (float centreDelayMs, float depth, float feedback) noexcept;
     
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BasicChorusAudioProcessor)
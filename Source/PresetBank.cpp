@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    PresetBank.cpp
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+
+namespace
+{
+    constexpr juce::uint32 bankMagic = StateFormat::makeChunkId ("BCbk");
+    constexpr int bankHeaderSize = 8;
+}
+
+//==============================================================================
+int PresetBank::addBank (const void* data, size_t sizeInBytes)
+{
+    const auto* bytes = static_cast<const juce::uint8*> (data);
+
+    if (bytes == nullptr || sizeInBytes < (size_t) bankHeaderSize
+         || juce::ByteOrder::littleEndianInt (bytes) != bankMagic)
+        return 0;
+
+    const auto numPresets = (size_t) juce::ByteOrder::littleEndianInt (bytes + 4);
+
+    // Checks every entry first, so that a damaged bank adds nothing at all
+    std::vector<std::pair<const juce::uint8*, int>> entries;
+    size_t position = bankHeaderSize;
+
+    for (size_t i = 0; i < numPresets; ++i)
+    {
+        if (sizeInBytes - position < 4)
+            return 0;
+
+        const auto size = (size_t) juce::ByteOrder::littleEndianInt (bytes + position);
+        position += 4;
+
+        if (size > sizeInBytes - position || size > (size_t) std::numeric_limits<int>::max()
+             || ! StateFormat::Reader (bytes + position, (int) size).isValid())
+            return 0;
+
+        entries.emplace_back (bytes + position, (int) size);
+        position += size;
+    }
+
+    for (const auto& entry : entries)
+    {
+        const StateFormat::Reader reader (entry.first, entry.second);
+        Preset preset;
+
+        preset.numValues = juce::jmin (reader.getNumParameterValues(), StateFormat::numParameters);
+
+        for (int i = 0; i < preset.numValues; ++i)
+            preset.values[i] = reader.getParameterValue (i);
+
+        int nameSize = 0;
+
+        if (const auto* name = reader.findChunk (nameChunkId, nameSize))
+            preset.name = juce::String::fromUTF8 (static_cast<const char*> (name), nameSize);
+
+        if (preset.name.isEmpty())
+            preset.name = "Preset " + juce::String (presets.size() + 1);
+
+        presets.push_back (std::move (preset));
+    }
+
+    return (int) entries.size();
+}
+
+int PresetBank::addBankFile (const juce::File& file)
+{
+    if (! file.existsAsFile())
+        return 0;
+
+    const juce::MemoryMappedFile mappedFile (file, juce::MemoryMappedFile::readOnly);
+
+    if (mappedFile.getData() == nullptr)
+        return 0;
+
+    return addBank (mappedFile.getData(), mappedFile.getSize());
+}
+
+juce::File PresetBank::getUserBankFile()
+{
+    return juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+               .getChildFile ("The Audio Programmer")
+               .getChildFile ("basicChorus")
+               .getChildFile ("User Presets.bcbank");
+}
+
+juce::String PresetBank::getPresetName (int index) const
+{
+    if (! juce::isPositiveAndBelow (index, getNumPresets()))
+        return {};
+
+    const juce::SpinLock::ScopedLockType lock (nameLock);
+    return presets[(size_t) index].name;
+}
+
+void PresetBank::setPresetName (int index, const juce::String& newName)
+{
+    if (! juce::isPositiveAndBelow (index, getNumPresets()))
+        return;
+
+    // The old name is released outside the lock, in case that frees it
+    auto name = newName;
+
+    {
+        const juce::SpinLock::ScopedLockType lock (nameLock);
+        std::swap (presets[(size_t) index].name, name);
+    }
+}
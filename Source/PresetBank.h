@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+
+    A table of named parameter sets, read from bank files and embedded data.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "StateFormat.h"
+
+//==============================================================================
+/**
+    The programs offered to the host.
+
+    A bank is the magic "BCbk", a little-endian 32-bit preset count, and then for
+    each preset a 32-bit size followed by a state in StateFormat, with the name
+    stored in a "NAME" chunk. Every state is validated and parsed into the table
+    when the bank is added, so reading a preset later never touches the source
+    data and never allocates.
+*/
+class PresetBank
+{
+public:
+    //==============================================================================
+    struct Preset
+    {
+        juce::String name;
+        float values[StateFormat::numParameters] {};
+        int numValues = 0;
+    };
+
+    static constexpr juce::uint32 nameChunkId = StateFormat::makeChunkId ("NAME");
+
+    //==============================================================================
+    PresetBank() = default;
+
+    /** Parses a bank held in memory and appends its presets. Returns the number
+        of presets added; a malformed bank adds none.
+    */
+    int addBank (const void* data, size_t sizeInBytes);
+
+    /** Memory-maps a bank file and appends its presets. */
+    int addBankFile (const juce::File& file);
+
+    /** The bank file that the plugin loads after its factory presets. */
+    static juce::File getUserBankFile();
+
+    int getNumPresets() const noexcept                      { return (int) presets.size(); }
+
+    /** A preset's values. Read names with getPresetName(), as they can change. */
+    const Preset& getPreset (int index) const noexcept      { return presets[(size_t) index]; }
+
+    /** A copy of a preset's name, or an empty string. This can be called from
+        any thread; it doesn't allocate, and only waits for a rename to finish.
+    */
+    juce::String getPresetName (int index) const;
+
+    /** Renames a preset. Call this from the message thread. */
+    void setPresetName (int index, const juce::String& newName);
+
+private:
+    std::vector<Preset> presets;
+    mutable juce::SpinLock nameLock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetBank)
+};
@@ -0,0 +1,216 @@
+/*
+  ==============================================================================
+
+    ProcessTimer.h
+
+    Lock-free timing of processed blocks, for reading from any thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Records how long each processed block took in a histogram that the audio
+    thread writes without waiting, and any other thread can read.
+
+    Blocks are timed with the high resolution tick counter. Each bin is a
+    relaxed atomic counter with a single writer, so a reader may see a block
+    that is only partly recorded, but never a torn value. Readers take a
+    Snapshot, and work out statistics over the time between two of them.
+*/
+class ProcessTimer
+{
+public:
+    //==============================================================================
+    /** Bins below 16 ns are 1 ns wide; above that each octave has 16 bins. */
+    static constexpr int numBins = 512;
+    static constexpr int binsPerOctave = 16;
+
+    /** Timing figures over a run of blocks. Times are in microseconds, rounded
+        down to the start of their bin.
+    */
+    struct Statistics
+    {
+        juce::int64 numBlocks = 0;
+        double p50Microseconds = 0.0, p99Microseconds = 0.0, maxMicroseconds = 0.0;
+
+        /** Time spent processing as a fraction of the duration of the audio. */
+        double deadlineFraction = 0.0;
+
+        /** The fraction of blocks that took longer than their own duration. */
+        double overrunFraction = 0.0;
+    };
+
+    /** A copy of the counters at one moment. */
+    struct Snapshot
+    {
+        juce::uint32 bins[numBins] {};
+        juce::int64 numBlocks = 0, numOverruns = 0;
+        juce::uint64 processingNanoseconds = 0, audioNanoseconds = 0;
+
+        /** The statistics for the blocks recorded after an earlier snapshot. */
+        Statistics getStatisticsSince (const Snapshot& earlier) const noexcept
+        {
+            Statistics statistics;
+            statistics.numBlocks = numBlocks - earlier.numBlocks;
+
+            if (statistics.numBlocks <= 0)
+                return statistics;
+
+            const auto p50Count = (statistics.numBlocks + 1) / 2;
+            const auto p99Count = statistics.numBlocks - statistics.numBlocks / 100;
+            juce::int64 count = 0;
+
+            for (int bin = 0; bin < numBins; ++bin)
+            {
+                const auto binCount = (juce::int64) (juce::uint32) (bins[bin] - earlier.bins[bin]);
+
+                if (binCount == 0)
+                    continue;
+
+                const auto microseconds = (double) getBinStartNanoseconds (bin) / 1000.0;
+
+                if (count < p50Count && count + binCount >= p50Count)
+                    statistics.p50Microseconds = microseconds;
+
+                if (count < p99Count && count + binCount >= p99Count)
+                    statistics.p99Microseconds = microseconds;
+
+                statistics.maxMicroseconds = microseconds;
+                count += binCount;
+            }
+
+            const auto audioTime = audioNanoseconds - earlier.audioNanoseconds;
+
+            if (audioTime > 0)
+                statistics.deadlineFraction = (double) (processingNanoseconds - earlier.processingNanoseconds) / (double) audioTime;
+
+            statistics.overrunFraction = (double) (numOverruns - earlier.numOverruns) / (double) statistics.numBlocks;
+            return statistics;
+        }
+    };
+
+    //==============================================================================
+    /** Times the enclosing scope as one block of the given length. */
+    struct ScopedMeasurement
+    {
+        ScopedMeasurement (ProcessTimer& timerToUse, int blockSize) noexcept
+            : timer (timerToUse), numSamples (blockSize), startTicks (juce::Time::getHighResolutionTicks())
+        {
+        }
+
+        ~ScopedMeasurement() noexcept
+        {
+            timer.addBlock (juce::Time::getHighResolutionTicks() - startTicks, numSamples);
+        }
+
+        ProcessTimer& timer;
+        const int numSamples;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedMeasurement)
+    };
+
+    //==============================================================================
+    ProcessTimer() = default;
+
+    /** Sets the rate used to work out each block's deadline, and clears the
+        counters. This must not be called while a block is being recorded.
+    */
+    void prepare (double newSampleRate) noexcept
+    {
+        jassert (newSampleRate > 0);
+        nanosecondsPerSample = 1.0e9 / newSampleRate;
+
+        for (auto& bin : bins)
+            bin.store (0, std::memory_order_relaxed);
+
+        for (auto* counter : { &numBlocks, &numOverruns })
+            counter->store (0, std::memory_order_relaxed);
+
+        for (auto* counter : { &processingNanoseconds, &audioNanoseconds })
+            counter->store (0, std::memory_order_relaxed);
+    }
+
+    /** Records one block. Only the audio thread may call this. */
+    void addBlock (juce::int64 elapsedTicks, int numSamples) noexcept
+    {
+        const auto elapsed = (juce::uint64) juce::jmax ((juce::int64) 0, elapsedTicks) * 1000000000ull
+                               / (juce::uint64) ticksPerSecond;
+        const auto deadline = (juce::uint64) ((double) numSamples * nanosecondsPerSample);
+
+        // There's only one writer, so a load and a store are enough
+        auto& bin = bins[getBin (elapsed)];
+        bin.store (bin.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        processingNanoseconds.store (processingNanoseconds.load (std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+        audioNanoseconds.store (audioNanoseconds.load (std::memory_order_relaxed) + deadline, std::memory_order_relaxed);
+
+        if (elapsed > deadline)
+            numOverruns.store (numOverruns.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        // Published last, so a reader never counts more blocks than are binned
+        numBlocks.store (numBlocks.load (std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /** Copies the counters. This never blocks the audio thread. */
+    void getSnapshot (Snapshot& snapshot) const noexcept
+    {
+        snapshot.numBlocks = numBlocks.load (std::memory_order_acquire);
+
+        for (int i = 0; i < numBins; ++i)
+            snapshot.bins[i] = bins[i].load (std::memory_order_relaxed);
+
+        snapshot.numOverruns = numOverruns.load (std::memory_order_relaxed);
+        snapshot.processingNanoseconds = processingNanoseconds.load (std::memory_order_relaxed);
+        snapshot.audioNanoseconds = audioNanoseconds.load (std::memory_order_relaxed);
+    }
+
+    /** The statistics for every block since prepare(). */
+    Statistics getStatistics() const noexcept
+    {
+        Snapshot snapshot;
+        getSnapshot (snapshot);
+        return snapshot.getStatisticsSince ({});
+    }
+
+    //==============================================================================
+    /** The bin for a duration, from its highest set bit and the 4 bits below. */
+    static int getBin (juce::uint64 nanoseconds) noexcept
+    {
+        if (nanoseconds < (juce::uint64) binsPerOctave)
+            return (int) nanoseconds;
+
+        auto octave = 0;
+
+        while ((nanoseconds >> (octave + 1)) != 0)
+            ++octave;
+
+        const auto subBin = (int) (nanoseconds >> (octave - 4)) & (binsPerOctave - 1);
+        return juce::jmin (numBins - 1, (octave - 3) * binsPerOctave + subBin);
+    }
+
+    static juce::uint64 getBinStartNanoseconds (int bin) noexcept
+    {
+        if (bin < binsPerOctave)
+            return (juce::uint64) bin;
+
+        const auto octave = bin / binsPerOctave + 3;
+        return (juce::uint64) (binsPerOctave + bin % binsPerOctave) << (octave - 4);
+    }
+
+private:
+    //==============================================================================
+    std::atomic<juce::uint32> bins[numBins] {};
+    std::atomic<juce::int64> numBlocks { 0 }, numOverruns { 0 };
+    std::atomic<juce::uint64> processingNanoseconds { 0 }, audioNanoseconds { 0 };
+
+    const juce::int64 ticksPerSecond = juce::Time::getHighResolutionTicksPerSecond();
+    double nanosecondsPerSample = 1.0e9 / 44100.0;
+
+    JUCE_DECLARE_NON_COPYABLE (ProcessTimer)
+};
@@ -0,0 +1,25 @@
+/*
+  ==============================================================================
+
+    ScopeQueue.h
+
+    A lock-free queue of decimated chorus readings for the editor's scope.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "SpscQueue.h"
+
+//==============================================================================
+/** The state of the chorus at one point, and the peaks since the last one. */
+struct ScopeSnapshot
+{
+    float delayMs;
+    float dryPeak;
+    float wetPeak;
+};
+
+/** Snapshots written by the audio thread and read by the editor. */
+using ScopeQueue = SpscQueue<ScopeSnapshot>;
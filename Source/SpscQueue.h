@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    SpscQueue.h
+
+    A lock-free, fixed-capacity queue with one writer and one reader.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    A single-producer, single-consumer FIFO of trivially copyable items.
+
+    The storage is allocated once in the constructor; push, peek and pop are
+    wait-free and can be called from the audio thread. Items are dropped while
+    the queue is full.
+*/
+template <typename Type>
+class SpscQueue
+{
+public:
+    explicit SpscQueue (int capacity)
+        : fifo (capacity), items ((size_t) capacity)
+    {
+    }
+
+    /** Adds an item. Returns false, dropping the item, if the queue is full. */
+    bool push (const Type& item) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+        if (size1 + size2 == 0)
+            return false;
+
+        items[(size_t) (size1 > 0 ? start1 : start2)] = item;
+        fifo.finishedWrite (1);
+        return true;
+    }
+
+    /** Copies the oldest item without removing it. Returns false if empty. */
+    bool peek (Type& item) const noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (1, start1, size1, start2, size2);
+
+        if (size1 + size2 == 0)
+            return false;
+
+        item = items[(size_t) (size1 > 0 ? start1 : start2)];
+        return true;
+    }
+
+    /** Removes the oldest item. Returns false if empty. */
+    bool pop (Type& item) noexcept
+    {
+        if (! peek (item))
+            return false;
+
+        fifo.finishedRead (1);
+        return true;
+    }
+
+private:
+    static_assert (std::is_trivially_copyable<Type>::value, "Items are copied in and out of the queue");
+
+    juce::AbstractFifo fifo;
+    std::vector<Type> items;
+
+    JUCE_DECLARE_NON_COPYABLE (SpscQueue)
+};
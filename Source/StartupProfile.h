@@ -0,0 +1,133 @@
+/*
+  ==============================================================================
+
+    StartupProfile.h
+
+    Timestamps for the stages of bringing up a processor and its editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    When each startup stage began and how long it took, in milliseconds from
+    the moment the profile was created.
+
+    Only the first run of a stage is kept, so later calls to prepareToPlay() or
+    later editors don't overwrite the cold figures. Stages can be recorded from
+    any thread, and read from any other.
+*/
+class StartupProfile
+{
+public:
+    //==============================================================================
+    enum class Stage
+    {
+        constructor = 0,
+        createParameters,
+        prepareToPlay,
+        createEditor,
+        firstPaint,
+        numStages
+    };
+
+    struct Timestamp
+    {
+        double startMs = -1.0, durationMs = -1.0;
+
+        bool wasRecorded() const noexcept       { return durationMs >= 0.0; }
+    };
+
+    /** Times the enclosing scope as a stage. */
+    struct ScopedStage
+    {
+        ScopedStage (StartupProfile& profileToUse, Stage stageToTime) noexcept
+            : profile (profileToUse), stage (stageToTime), startTicks (juce::Time::getHighResolutionTicks())
+        {
+        }
+
+        ~ScopedStage() noexcept
+        {
+            profile.record (stage, startTicks, juce::Time::getHighResolutionTicks());
+        }
+
+        StartupProfile& profile;
+        const Stage stage;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedStage)
+    };
+
+    //==============================================================================
+    StartupProfile() = default;
+
+    /** Records a stage between two high resolution tick counts, unless it has
+        already been recorded.
+    */
+    void record (Stage stage, juce::int64 startTicks, juce::int64 endTicks) noexcept
+    {
+        auto& entry = entries[(size_t) stage];
+
+        if (entry.claimed.exchange (true))
+            return;
+
+        entry.startMs = toMilliseconds (startTicks - creationTicks);
+        entry.durationMs = toMilliseconds (endTicks - startTicks);
+        entry.recorded.store (true, std::memory_order_release);
+    }
+
+    /** Records a stage that started when the profile was created. */
+    void recordSinceCreation (Stage stage) noexcept
+    {
+        record (stage, creationTicks, juce::Time::getHighResolutionTicks());
+    }
+
+    /** The stage's timestamp, or one for which wasRecorded() is false. */
+    Timestamp getTimestamp (Stage stage) const noexcept
+    {
+        const auto& entry = entries[(size_t) stage];
+
+        if (! entry.recorded.load (std::memory_order_acquire))
+            return {};
+
+        return { entry.startMs, entry.durationMs };
+    }
+
+    static const char* getStageName (Stage stage) noexcept
+    {
+        switch (stage)
+        {
+            case Stage::constructor:        return "constructor";
+            case Stage::createParameters:   return "createParameters";
+            case Stage::prepareToPlay:      return "prepareToPlay";
+            case Stage::createEditor:       return "createEditor";
+            case Stage::firstPaint:         return "firstPaint";
+            case Stage::numStages:
+            default:                        break;
+        }
+
+        return "";
+    }
+
+private:
+    //==============================================================================
+    static double toMilliseconds (juce::int64 ticks) noexcept
+    {
+        return juce::Time::highResolutionTicksToSeconds (ticks) * 1000.0;
+    }
+
+    struct Entry
+    {
+        std::atomic<bool> claimed { false }, recorded { false };
+        double startMs = 0.0, durationMs = 0.0;
+    };
+
+    const juce::int64 creationTicks = juce::Time::getHighResolutionTicks();
+    Entry entries[(size_t) Stage::numStages];
+
+    JUCE_DECLARE_NON_COPYABLE (StartupProfile)
+};
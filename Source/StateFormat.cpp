@@ -0,0 +1,181 @@
+/*
+  ==============================================================================
+
+    StateFormat.cpp
+
+  ==============================================================================
+*/
+
+#include "StateFormat.h"
+
+namespace
+{
+    constexpr juce::uint32 magic = StateFormat::makeChunkId ("BCst");
+
+    juce::uint32 addToChecksum (juce::uint32 hash, const juce::uint8* data, size_t numBytes) noexcept
+    {
+        for (size_t i = 0; i < numBytes; ++i)
+            hash = (hash ^ data[i]) * 16777619u;
+
+        return hash;
+    }
+
+    /** FNV-1a over the whole state, apart from the checksum field itself. */
+    juce::uint32 calculateChecksum (const juce::uint8* state, size_t payloadSize) noexcept
+    {
+        const auto hash = addToChecksum (2166136261u, state, 12);
+        return addToChecksum (hash, state + StateFormat::headerSize, payloadSize);
+    }
+
+    juce::uint32 readUint32 (const juce::uint8* data) noexcept
+    {
+        return juce::ByteOrder::littleEndianInt (data);
+    }
+
+    float readFloat (const juce::uint8* data) noexcept
+    {
+        const auto bits = readUint32 (data);
+        float value;
+        std::memcpy (&value, &bits, sizeof (value));
+        return value;
+    }
+
+    void writeUint32 (juce::uint8* data, juce::uint32 value) noexcept
+    {
+        value = juce::ByteOrder::swapIfBigEndian (value);
+        std::memcpy (data, &value, sizeof (value));
+    }
+
+    void writeUint16 (juce::uint8* data, juce::uint16 value) noexcept
+    {
+        value = juce::ByteOrder::swapIfBigEndian (value);
+        std::memcpy (data, &value, sizeof (value));
+    }
+}
+
+//==============================================================================
+bool StateFormat::hasBinaryHeader (const void* data, int sizeInBytes) noexcept
+{
+    return data != nullptr && sizeInBytes >= headerSize
+        && readUint32 (static_cast<const juce::uint8*> (data)) == magic;
+}
+
+//==============================================================================
+StateFormat::Writer::Writer (juce::MemoryBlock& destination, const float* parameterValues, int numValues)
+    : block (destination)
+{
+    jassert (numValues >= 0 && numValues <= 0xffff);
+
+    block.setSize ((size_t) (headerSize + numValues * 4), false);
+    auto* data = static_cast<juce::uint8*> (block.getData());
+
+    writeUint32 (data, magic);
+    writeUint16 (data + 4, (juce::uint16) currentVersion);
+    writeUint16 (data + 6, (juce::uint16) numValues);
+
+    for (int i = 0; i < numValues; ++i)
+    {
+        juce::uint32 bits;
+        std::memcpy (&bits, parameterValues + i, sizeof (bits));
+        writeUint32 (data + headerSize + i * 4, bits);
+    }
+
+    updateHeader();
+}
+
+void StateFormat::Writer::addChunk (juce::uint32 chunkId, const void* chunkData, int chunkSize)
+{
+    jassert (chunkSize >= 0);
+
+    juce::uint8 chunkHeader[chunkHeaderSize];
+    writeUint32 (chunkHeader, chunkId);
+    writeUint32 (chunkHeader + 4, (juce::uint32) chunkSize);
+
+    block.append (chunkHeader, sizeof (chunkHeader));
+    block.append (chunkData, (size_t) chunkSize);
+
+    updateHeader();
+}
+
+void StateFormat::Writer::updateHeader() noexcept
+{
+    auto* data = static_cast<juce::uint8*> (block.getData());
+    const auto payloadSize = block.getSize() - (size_t) headerSize;
+
+    writeUint32 (data + 8, (juce::uint32) payloadSize);
+    writeUint32 (data + 12, calculateChecksum (data, payloadSize));
+}
+
+//==============================================================================
+StateFormat::Reader::Reader (const void* data, int sizeInBytes) noexcept
+{
+    if (! hasBinaryHeader (data, sizeInBytes))
+        return;
+
+    const auto* bytes = static_cast<const juce::uint8*> (data);
+    const auto storedVersion = (int) juce::ByteOrder::littleEndianShort (bytes + 4);
+    const auto storedValues  = (int) juce::ByteOrder::littleEndianShort (bytes + 6);
+    const auto storedSize    = readUint32 (bytes + 8);
+
+    // Some hosts pad the blob they hand back, so trailing bytes are ignored
+    if (storedVersion < 1 || storedSize > (juce::uint32) (sizeInBytes - headerSize))
+        return;
+
+    const auto* storedPayload = bytes + headerSize;
+    const auto size = (int) storedSize;
+
+    if (storedValues * 4 > size
+         || calculateChecksum (bytes, (size_t) size) != readUint32 (bytes + 12))
+        return;
+
+    for (int i = 0; i < storedValues; ++i)
+        if (! std::isfinite (readFloat (storedPayload + i * 4)))
+            return;
+
+    // The chunks must tile the rest of the payload exactly
+    for (auto position = storedValues * 4; position != size;)
+    {
+        if (size - position < chunkHeaderSize)
+            return;
+
+        const auto chunkSize = readUint32 (storedPayload + position + 4);
+
+        if (chunkSize > (juce::uint32) (size - position - chunkHeaderSize))
+            return;
+
+        position += chunkHeaderSize + (int) chunkSize;
+    }
+
+    payload = storedPayload;
+    payloadSize = size;
+    numValues = storedValues;
+    version = storedVersion;
+    valid = true;
+}
+
+float StateFormat::Reader::getParameterValue (int index) const noexcept
+{
+    jassert (juce::isPositiveAndBelow (index, numValues));
+    return readFloat (payload + index * 4);
+}
+
+const void* StateFormat::Reader::findChunk (juce::uint32 chunkId, int& chunkSize) const noexcept
+{
+    if (! valid)
+        return nullptr;
+
+    for (auto position = numValues * 4; position < payloadSize;)
+    {
+        const auto size = (int) readUint32 (payload + position + 4);
+
+        if (readUint32 (payload + position) == chunkId)
+        {
+            chunkSize = size;
+            return payload + position + chunkHeaderSize;
+        }
+
+        position += chunkHeaderSize + size;
+    }
+
+    return nullptr;
+}
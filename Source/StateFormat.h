@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    StateFormat.h
+
+    The binary layout used to save and recall the plugin state.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+    A compact, versioned state blob. All values are little-endian.
+
+        offset  size  field
+        0       4     magic, "BCst"
+        4       2     version
+        6       2     number of parameter values
+        8       4     payload size, in bytes after the header
+        12      4     FNV-1a checksum of everything but this field
+        16            the parameter values, as 32-bit floats
+                      then any number of chunks: a 4-byte id, a 4-byte size and
+                      the chunk's data
+
+    The header and parameter block never change layout. Later versions may only
+    append parameter values and add chunks, so any version can be read by any
+    other: missing values keep their defaults, and unknown values and chunks
+    are skipped.
+*/
+namespace StateFormat
+{
+    constexpr int currentVersion = 1;
+    constexpr int headerSize = 16;
+    constexpr int chunkHeaderSize = 8;
+
+    /** The parameter IDs in the order they are stored. Only ever append to this. */
+    constexpr const char* parameterIds[] = { "RATE", "DEPTH", "CENTREDELAY", "FEEDBACK", "MIX", "VOICES",
+                                             "LFOSHAPE", "INTERPOLATION", "OVERSAMPLING", "OVERSAMPLINGFILTER",
+                                             "CHANNELSPREAD" };
+
+    constexpr int numParameters = (int) (sizeof (parameterIds) / sizeof (parameterIds[0]));
+
+    /** Makes a chunk id from four characters. */
+    constexpr juce::uint32 makeChunkId (const char (&name)[5]) noexcept
+    {
+        return (juce::uint32) (juce::uint8) name[0]
+            | ((juce::uint32) (juce::uint8) name[1] << 8)
+            | ((juce::uint32) (juce::uint8) name[2] << 16)
+            | ((juce::uint32) (juce::uint8) name[3] << 24);
+    }
+
+    /** Returns true if the data starts like a binary state, rather than a
+        legacy XML blob. It may still turn out to be corrupt.
+    */
+    bool hasBinaryHeader (const void* data, int sizeInBytes) noexcept;
+
+    //==============================================================================
+    /** Writes a state to a MemoryBlock, replacing its contents. */
+    class Writer
+    {
+    public:
+        Writer (juce::MemoryBlock& destination, const float* parameterValues, int numValues);
+
+        /** Appends a chunk after the parameter block. */
+        void addChunk (juce::uint32 chunkId, const void* chunkData, int chunkSize);
+
+    private:
+        void updateHeader() noexcept;
+
+        juce::MemoryBlock& block;
+    };
+
+    //==============================================================================
+    /**
+        Validates a state in place, without copying or allocating.
+
+        Everything is checked up front: the header, the sizes, the checksum, the
+        chunk boundaries and that every value is finite. If any check fails,
+        isValid() returns false and nothing should be read.
+    */
+    class Reader
+    {
+    public:
+        Reader (const void* data, int sizeInBytes) noexcept;
+
+        bool isValid() const noexcept                   { return valid; }
+        int getVersion() const noexcept                 { return version; }
+        int getNumParameterValues() const noexcept      { return numValues; }
+
+        float getParameterValue (int index) const noexcept;
+
+        /** Returns the data of the first chunk with this id, or nullptr. */
+        const void* findChunk (juce::uint32 chunkId, int& chunkSize) const noexcept;
+
+    private:
+        const juce::uint8* payload = nullptr;
+        int payloadSize = 0, numValues = 0, version = 0;
+        bool valid = false;
+    };
+}
@@ -0,0 +1,27 @@
+/*
+  ==============================================================================
+
+    Streams raw PCM from stdin to stdout through the basicChorus processor.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "PcmStream.h"
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand ("--help|-h", "Usage:", true);
+
+    app.addCommand ({ "--stream",
+                      "--stream [--format=float32|int16|int24] [--channels=N] [--sample-rate=N] [--block-size=N] [--state=file] [--program=N] [--<parameter>=value] [--offline-quality] [--report]",
+                      "Reads interleaved PCM from stdin, runs it through the chorus and writes it to stdout.",
+                      {},
+                      [] (const juce::ArgumentList& args) { runPcmStream (args); } });
+
+    return app.findAndRunCommand (argc, argv);
+}
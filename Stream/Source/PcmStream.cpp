@@ -0,0 +1,200 @@
+/*
+  ==============================================================================
+
+    PcmStream.cpp
+
+  ==============================================================================
+*/
+
+#include "PcmStream.h"
+#include "../../Source/PluginProcessor.h"
+
+#if JUCE_WINDOWS
+ #include <io.h>
+ #include <fcntl.h>
+#endif
+
+namespace
+{
+    //==============================================================================
+    /** Converts between interleaved PCM of one sample format and float channels. */
+    struct SampleConverter
+    {
+        int bytesPerSample;
+        void (*deinterleave) (const void* source, juce::AudioBuffer<float>& destination, int numSamples);
+        void (*interleave) (const juce::AudioBuffer<float>& source, int startSample, void* destination, int numSamples);
+    };
+
+    template <typename Format>
+    void deinterleave (const void* source, juce::AudioBuffer<float>& destination, int numSamples)
+    {
+        using Source = juce::AudioData::Pointer<Format, juce::AudioData::LittleEndian, juce::AudioData::Interleaved, juce::AudioData::Const>;
+        using Dest   = juce::AudioData::Pointer<juce::AudioData::Float32, juce::AudioData::NativeEndian, juce::AudioData::NonInterleaved, juce::AudioData::NonConst>;
+
+        const auto numChannels = destination.getNumChannels();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            Source sourceChannel (juce::addBytesToPointer (source, channel * Format::bytesPerSample), numChannels);
+            Dest (destination.getWritePointer (channel)).convertSamples (sourceChannel, numSamples);
+        }
+    }
+
+    template <typename Format>
+    void interleave (const juce::AudioBuffer<float>& source, int startSample, void* destination, int numSamples)
+    {
+        using Source = juce::AudioData::Pointer<juce::AudioData::Float32, juce::AudioData::NativeEndian, juce::AudioData::NonInterleaved, juce::AudioData::Const>;
+        using Dest   = juce::AudioData::Pointer<Format, juce::AudioData::LittleEndian, juce::AudioData::Interleaved, juce::AudioData::NonConst>;
+
+        const auto numChannels = source.getNumChannels();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            Dest destinationChannel (juce::addBytesToPointer (destination, channel * Format::bytesPerSample), numChannels);
+            destinationChannel.convertSamples (Source (source.getReadPointer (channel, startSample)), numSamples);
+        }
+    }
+
+    template <typename Format>
+    SampleConverter makeConverter()
+    {
+        return { Format::bytesPerSample, deinterleave<Format>, interleave<Format> };
+    }
+
+    SampleConverter getConverter (const juce::String& format)
+    {
+        if (format == "int16")      return makeConverter<juce::AudioData::Int16>();
+        if (format == "int24")      return makeConverter<juce::AudioData::Int24>();
+        if (format == "float32")    return makeConverter<juce::AudioData::Float32>();
+
+        juce::ConsoleApplication::fail ("Unknown sample format: " + format);
+        return {};
+    }
+
+    //==============================================================================
+    /** Applies --state, --program and any --<parameter>=value options. */
+    void applySettings (BasicChorusAudioProcessor& processor, const juce::ArgumentList& args)
+    {
+        if (args.containsOption ("--state"))
+        {
+            const auto stateFile = args.getExistingFileForOption ("--state");
+            juce::MemoryBlock state;
+
+            if (! stateFile.loadFileAsData (state))
+                juce::ConsoleApplication::fail ("Could not read " + stateFile.getFullPathName());
+
+            processor.setStateInformation (state.getData(), (int) state.getSize());
+        }
+
+        if (args.containsOption ("--program"))
+            processor.setCurrentProgram (args.getValueForOption ("--program").getIntValue());
+
+        for (auto* id : StateFormat::parameterIds)
+        {
+            const auto option = "--" + juce::String (id).toLowerCase();
+
+            if (! args.containsOption (option))
+                continue;
+
+            auto* parameter = processor.apvts.getParameter (id);
+            const auto value = args.getValueForOption (option).getFloatValue();
+            parameter->setValueNotifyingHost (parameter->convertTo0to1 (value));
+        }
+    }
+
+    /** Reads up to numFrames whole frames, returning the number read. */
+    int readFrames (void* destination, int frameSize, int numFrames)
+    {
+        return (int) std::fread (destination, (size_t) frameSize, (size_t) numFrames, stdin);
+    }
+
+    void writeFrames (const void* source, int frameSize, int numFrames)
+    {
+        if (std::fwrite (source, (size_t) frameSize, (size_t) numFrames, stdout) != (size_t) numFrames)
+            juce::ConsoleApplication::fail ("Could not write to stdout");
+    }
+}
+
+//==============================================================================
+void runPcmStream (const juce::ArgumentList& args)
+{
+   #if JUCE_WINDOWS
+    _setmode (_fileno (stdin), _O_BINARY);
+    _setmode (_fileno (stdout), _O_BINARY);
+   #endif
+
+    const auto converter   = getConverter (args.containsOption ("--format") ? args.getValueForOption ("--format") : "float32");
+    const auto numChannels = args.containsOption ("--channels") ? args.getValueForOption ("--channels").getIntValue() : 2;
+    const auto sampleRate  = args.containsOption ("--sample-rate") ? args.getValueForOption ("--sample-rate").getDoubleValue() : 48000.0;
+    const auto blockSize   = args.containsOption ("--block-size") ? args.getValueForOption ("--block-size").getIntValue() : 4096;
+
+    if (numChannels <= 0 || numChannels > ChorusEngineBase::maxChannels)
+        juce::ConsoleApplication::fail ("The number of channels must be from 1 to " + juce::String (ChorusEngineBase::maxChannels));
+
+    if (sampleRate <= 0.0 || blockSize <= 0)
+        juce::ConsoleApplication::fail ("The sample rate and block size must be positive");
+
+    BasicChorusAudioProcessor processor;
+    applySettings (processor, args);
+
+    processor.setNonRealtime (args.containsOption ("--offline-quality"));
+    processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+    processor.prepareToPlay (sampleRate, blockSize);
+
+    // Everything the loop touches is allocated here
+    const auto frameSize = converter.bytesPerSample * numChannels;
+    juce::HeapBlock<char> pcm ((size_t) (frameSize * blockSize), true);
+    juce::AudioBuffer<float> buffer (numChannels, blockSize);
+    juce::MidiBuffer midi;
+
+    // The output is delayed by any oversampling latency, so that many frames
+    // are dropped from the start and silence is fed in at the end to flush it.
+    auto framesToSkip = processor.getLatencySamples();
+    auto framesToFlush = framesToSkip;
+    juce::int64 totalFrames = 0;
+
+    const auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+    for (;;)
+    {
+        auto numFrames = readFrames (pcm.get(), frameSize, blockSize);
+
+        if (numFrames > 0)
+        {
+            buffer.setSize (numChannels, numFrames, false, false, true);
+            converter.deinterleave (pcm.get(), buffer, numFrames);
+            totalFrames += numFrames;
+        }
+        else if (framesToFlush > 0)
+        {
+            numFrames = juce::jmin (framesToFlush, blockSize);
+            framesToFlush -= numFrames;
+            buffer.setSize (numChannels, numFrames, false, false, true);
+            buffer.clear();
+        }
+        else
+        {
+            break;
+        }
+
+        processor.processBlock (buffer, midi);
+
+        const auto numToSkip = juce::jmin (framesToSkip, numFrames);
+        framesToSkip -= numToSkip;
+
+        converter.interleave (buffer, numToSkip, pcm.get(), numFrames - numToSkip);
+        writeFrames (pcm.get(), frameSize, numFrames - numToSkip);
+    }
+
+    std::fflush (stdout);
+    processor.releaseResources();
+
+    if (args.containsOption ("--report"))
+    {
+        const auto seconds = (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0;
+        const auto audioSeconds = (double) totalFrames / sampleRate;
+
+        std::cerr << "Processed " << audioSeconds << " s of audio in " << seconds << " s ("
+                  << (seconds > 0.0 ? audioSeconds / seconds : 0.0) << "x realtime)" << std::endl;
+    }
+}
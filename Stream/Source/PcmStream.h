@@ -0,0 +1,35 @@
+/*
+  ==============================================================================
+
+    PcmStream.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Filters interleaved little-endian PCM from stdin to stdout through
+    BasicChorusAudioProcessor::processBlock.
+
+    All buffers are allocated before the first block is read, so memory use
+    stays fixed however long the stream is. The output is in the same format
+    as the input and has the same length, with any oversampling latency
+    removed.
+
+    Options:
+        --format=float32|int16|int24    the sample format, float32 by default
+        --channels=N                    number of interleaved channels
+        --sample-rate=N                 sample rate of the stream
+        --block-size=N                  samples per channel processed at a time
+        --state=<file>                  a saved plugin state to start from
+        --program=N                     a program from the preset bank to start from
+        --<parameter>=value             sets a parameter in its own range, e.g.
+                                        --centredelay=7 or --mix=0.5
+        --offline-quality               use the offline quality profile
+        --report                        print the throughput to stderr at the end
+*/
+void runPcmStream (const juce::ArgumentList& args);
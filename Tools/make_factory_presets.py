@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+Writes Source/FactoryPresets.h and Source/FactoryPresets.cpp, which embed the
+factory preset bank in the same way as the Projucer embeds binary data.
+
+The bank layout is described in Source/PresetBank.h, and each preset is a
+state in the layout described in Source/StateFormat.h.
+
+    python3 Tools/make_factory_presets.py
+"""
+
+import os
+import struct
+
+# In the order of StateFormat::parameterIds
+PARAMETER_IDS = ["RATE", "DEPTH", "CENTREDELAY", "FEEDBACK", "MIX", "VOICES",
+                 "LFOSHAPE", "INTERPOLATION", "OVERSAMPLING", "OVERSAMPLINGFILTER",
+                 "CHANNELSPREAD"]
+
+SINE, TRIANGLE, RANDOM = 0, 1, 2
+LINEAR, LAGRANGE, THIRAN = 0, 1, 2
+
+PRESETS = [
+    ("Init",            dict(RATE=0, DEPTH=0.0,  CENTREDELAY=1,  FEEDBACK=0.0,  MIX=0.0,  VOICES=1)),
+    ("Classic Chorus",  dict(RATE=1, DEPTH=0.35, CENTREDELAY=7,  FEEDBACK=0.0,  MIX=0.5,  VOICES=2, CHANNELSPREAD=0.5)),
+    ("Subtle Doubler",  dict(RATE=1, DEPTH=0.1,  CENTREDELAY=20, FEEDBACK=0.0,  MIX=0.35, VOICES=1, LFOSHAPE=RANDOM,
+                             INTERPOLATION=LAGRANGE, CHANNELSPREAD=0.5)),
+    ("Wide Ensemble",   dict(RATE=1, DEPTH=0.5,  CENTREDELAY=12, FEEDBACK=0.1,  MIX=0.6,  VOICES=6,
+                             INTERPOLATION=LAGRANGE, CHANNELSPREAD=1.0)),
+    ("Jet Flanger",     dict(RATE=1, DEPTH=0.15, CENTREDELAY=2,  FEEDBACK=0.7,  MIX=0.5,  VOICES=1, LFOSHAPE=TRIANGLE,
+                             INTERPOLATION=THIRAN)),
+    ("Hollow Flanger",  dict(RATE=1, DEPTH=0.15, CENTREDELAY=2,  FEEDBACK=-0.7, MIX=0.5,  VOICES=1, LFOSHAPE=TRIANGLE,
+                             INTERPOLATION=THIRAN)),
+    ("Vibrato",         dict(RATE=5, DEPTH=0.2,  CENTREDELAY=5,  FEEDBACK=0.0,  MIX=1.0,  VOICES=1, INTERPOLATION=LAGRANGE)),
+    ("Random Shimmer",  dict(RATE=2, DEPTH=0.4,  CENTREDELAY=15, FEEDBACK=0.3,  MIX=0.5,  VOICES=8, LFOSHAPE=RANDOM,
+                             INTERPOLATION=LAGRANGE, OVERSAMPLING=1, CHANNELSPREAD=1.0)),
+]
+
+
+def fnv1a(data, hash_value=2166136261):
+    for byte in data:
+        hash_value = ((hash_value ^ byte) * 16777619) & 0xffffffff
+    return hash_value
+
+
+def make_state(name, values):
+    parameters = b"".join(struct.pack("<f", float(values.get(pid, 0))) for pid in PARAMETER_IDS)
+    name_bytes = name.encode("utf-8")
+    payload = parameters + struct.pack("<4sI", b"NAME", len(name_bytes)) + name_bytes
+
+    header = struct.pack("<4sHHI", b"BCst", 1, len(PARAMETER_IDS), len(payload))
+    checksum = fnv1a(payload, fnv1a(header))
+    return header + struct.pack("<I", checksum) + payload
+
+
+def make_bank(presets):
+    bank = struct.pack("<4sI", b"BCbk", len(presets))
+
+    for name, values in presets:
+        state = make_state(name, values)
+        bank += struct.pack("<I", len(state)) + state
+
+    return bank
+
+
+def write_sources(bank, source_dir):
+    with open(os.path.join(source_dir, "FactoryPresets.h"), "w", newline="\r\n") as header:
+        header.write("/* (Auto-generated binary data file). */\n\n"
+                     "#pragma once\n\n"
+                     "namespace FactoryPresets\n"
+                     "{\n"
+                     "    extern const char*  factory_bank;\n"
+                     "    const int           factory_bankSize = %d;\n"
+                     "}\n" % len(bank))
+
+    lines = []
+    line = "static const unsigned char temp1[] = {"
+
+    for i, byte in enumerate(bank):
+        line += "%d," % byte if i < len(bank) - 1 else "%d" % byte
+
+        if len(line) > 140:
+            lines.append(line)
+            line = "  "
+
+    lines.append(line + ",0,0};")
+
+    with open(os.path.join(source_dir, "FactoryPresets.cpp"), "w", newline="\r\n") as source:
+        source.write("/* (Auto-generated binary data file). */\n\n"
+                     "#include \"FactoryPresets.h\"\n\n"
+                     + "\n".join(lines) + "\n"
+                     "const char* FactoryPresets::factory_bank = (const char*) temp1;\n")
+
+
+if __name__ == "__main__":
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    write_sources(make_bank(PRESETS), os.path.join(root, "Source"))
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Writes Source/LogoPixels.h and Source/LogoPixels.cpp, which hold the logo from
+Assets/ already decoded and scaled to the sizes the editor draws it at, so that
+opening an editor never has to decode or resample a PNG.
+
+Each image is premultiplied ARGB, one 0xAARRGGBB value per pixel, row by row,
+which is the layout of juce::PixelARGB. The sizes follow the tapImage bounds in
+BasicChorusAudioProcessorEditor::resized(), at 1x and 2x display scale, and
+have to be regenerated if that layout changes.
+
+    python3 Tools/make_logo_pixels.py
+"""
+
+import os
+import struct
+import zlib
+
+SOURCE_IMAGE = os.path.join("Assets", "Lockup 3- Curves.png")
+
+# The editor is 400 x 350 and the logo is placed at (0.005, 0.005, 0.45, 0.25)
+# of that, rounded as Component::setBoundsRelative() rounds, to nearest even.
+EDITOR_WIDTH, EDITOR_HEIGHT = 400, 350
+LOGO_WIDTH = round(0.45 * EDITOR_WIDTH)
+LOGO_HEIGHT = round(0.25 * EDITOR_HEIGHT)
+SCALES = [1, 2]
+
+
+def read_png(path):
+    """Returns (width, height, rows) of an 8-bit RGBA, non-interlaced PNG."""
+    with open(path, "rb") as png:
+        data = png.read()
+
+    assert data[:8] == b"\x89PNG\r\n\x1a\n", "not a PNG"
+    position, compressed = 8, b""
+
+    while position < len(data):
+        length, kind = struct.unpack(">I4s", data[position:position + 8])
+        body = data[position + 8:position + 8 + length]
+        position += length + 12
+
+        if kind == b"IHDR":
+            width, height, depth, colour_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            assert depth == 8 and colour_type == 6 and interlace == 0, "only 8-bit RGBA is supported"
+        elif kind == b"IDAT":
+            compressed += body
+        elif kind == b"IEND":
+            break
+
+    raw = zlib.decompress(compressed)
+    stride = width * 4
+    rows, previous = [], bytearray(stride)
+
+    for y in range(height):
+        start = y * (stride + 1)
+        filter_type, row = raw[start], bytearray(raw[start + 1:start + 1 + stride])
+
+        for i in range(stride):
+            left = row[i - 4] if i >= 4 else 0
+            up = previous[i]
+            up_left = previous[i - 4] if i >= 4 else 0
+
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xff
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xff
+            elif filter_type == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xff
+            elif filter_type == 4:
+                estimate = left + up - up_left
+                distances = abs(estimate - left), abs(estimate - up), abs(estimate - up_left)
+                predictor = left if distances[0] <= distances[1] and distances[0] <= distances[2] \
+                            else up if distances[1] <= distances[2] else up_left
+                row[i] = (row[i] + predictor) & 0xff
+
+        rows.append(row)
+        previous = row
+
+    return width, height, rows
+
+
+def premultiply(width, height, rows):
+    """Returns the image as rows of [a, r, g, b] floats, premultiplied."""
+    image = []
+
+    for row in rows:
+        pixels = []
+
+        for x in range(width):
+            r, g, b, a = row[x * 4:x * 4 + 4]
+            alpha = a / 255.0
+            pixels.append([float(a), r * alpha, g * alpha, b * alpha])
+
+        image.append(pixels)
+
+    return image
+
+
+def box_weights(source_size, target_size):
+    """For each target pixel, the source pixels it covers and by how much."""
+    ratio = source_size / target_size
+    weights = []
+
+    for target in range(target_size):
+        start, end = target * ratio, (target + 1) * ratio
+        covered = []
+
+        for source in range(int(start), min(source_size, int(end) + 1)):
+            overlap = min(end, source + 1) - max(start, source)
+
+            if overlap > 0:
+                covered.append((source, overlap / ratio))
+
+        weights.append(covered)
+
+    return weights
+
+
+def resample(image, width, height, target_width, target_height):
+    """Area-averages the premultiplied image, which is exact for downscaling."""
+    columns, lines = box_weights(width, target_width), box_weights(height, target_height)
+
+    horizontal = [[[sum(row[source][c] * weight for source, weight in covered) for c in range(4)]
+                   for covered in columns] for row in image]
+
+    return [[[sum(horizontal[source][x][c] * weight for source, weight in covered) for c in range(4)]
+             for x in range(target_width)] for covered in lines]
+
+
+def pack(pixels):
+    values = []
+
+    for row in pixels:
+        for a, r, g, b in row:
+            a, r, g, b = (min(255, int(round(v))) for v in (a, r, g, b))
+            values.append((a << 24) | (min(r, a) << 16) | (min(g, a) << 8) | min(b, a))
+
+    return values
+
+
+def write_sources(images, source_dir):
+    with open(os.path.join(source_dir, "LogoPixels.h"), "w", newline="\r\n") as header:
+        header.write("/* (Auto-generated pixel data file). */\n\n"
+                     "#pragma once\n\n"
+                     "namespace LogoPixels\n"
+                     "{\n"
+                     "    // Premultiplied 0xAARRGGBB, row by row, as in juce::PixelARGB\n")
+
+        for scale, width, height, _ in images:
+            header.write("    extern const unsigned int*  logo_%dx;\n"
+                         "    const int                   logo_%dxWidth = %d;\n"
+                         "    const int                   logo_%dxHeight = %d;\n" % (scale, scale, width, scale, height))
+
+        header.write("}\n")
+
+    with open(os.path.join(source_dir, "LogoPixels.cpp"), "w", newline="\r\n") as source:
+        source.write("/* (Auto-generated pixel data file). */\n\n"
+                     "#include \"LogoPixels.h\"\n\n")
+
+        for index, (scale, _, _, values) in enumerate(images):
+            lines, line = [], "static const unsigned int temp%d[] = {" % (index + 1)
+
+            for i, value in enumerate(values):
+                line += ("0x%x" % value if value else "0") + ("," if i < len(values) - 1 else "")
+
+                if len(line) > 140:
+                    lines.append(line)
+                    line = "  "
+
+            lines.append(line + "};")
+            source.write("\n".join(lines) + "\n")
+
+        for index, (scale, _, _, _) in enumerate(images):
+            source.write("const unsigned int* LogoPixels::logo_%dx = temp%d;\n" % (scale, index + 1))
+
+
+if __name__ == "__main__":
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    width, height, rows = read_png(os.path.join(root, SOURCE_IMAGE))
+    image = premultiply(width, height, rows)
+
+    images = []
+
+    for scale in SCALES:
+        target_width, target_height = LOGO_WIDTH * scale, LOGO_HEIGHT * scale
+        pixels = resample(image, width, height, target_width, target_height)
+        images.append((scale, target_width, target_height, pack(pixels)))
+
+    write_sources(images, os.path.join(root, "Source"))